@@ -11,6 +11,8 @@
 
 // Standard library
 #include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
 #include <time.h>
 
 // log module
@@ -26,6 +28,16 @@
     #include <semaphore.h>
 #endif
 
+// Preprocessor macros
+#define SYNC_HAZPTR_SLOTS 4
+#define SYNC_MONITOR_QUEUES 8
+#define SYNC_BARRIER_SERIAL_THREAD 2
+#define SYNC_PHASER_MAX_PARTIES 65535
+#define SYNC_LATCH_WAITERS 0x80000000U
+#define SYNC_LATCH_COUNT 0x7fffffffU
+#define SYNC_ONCE_DONE 3
+#define SYNC_ONCE_INIT { 0 }
+
 // Platform dependent macros
 #ifdef _WIN64
 #define DLLEXPORT extern __declspec(dllexport)
@@ -33,29 +45,199 @@
 #define DLLEXPORT
 #endif
 
+// Enumeration definitions
+enum sync_trace_event_e
+{
+    SYNC_TRACE_MUTEX_LOCK     = 0,
+    SYNC_TRACE_MUTEX_ACQUIRED = 1,
+    SYNC_TRACE_MUTEX_UNLOCK   = 2,
+    SYNC_TRACE_EVENT_QUANTITY = 3
+};
+
+enum rwlock_policy_e
+{
+    SYNC_RWLOCK_PREFER_READER = 0,
+    SYNC_RWLOCK_PREFER_WRITER = 1,
+    SYNC_RWLOCK_PHASE_FAIR    = 2,
+    SYNC_RWLOCK_POLICY_QUANTITY = 3
+};
+
+enum sync_pool_affinity_e
+{
+    SYNC_POOL_AFFINITY_NONE     = 0,
+    SYNC_POOL_AFFINITY_COMPACT  = 1,
+    SYNC_POOL_AFFINITY_SCATTER  = 2,
+    SYNC_POOL_AFFINITY_QUANTITY = 3
+};
+
+// Typedefs
+typedef int64_t timestamp;
+typedef enum sync_trace_event_e sync_trace_event;
+typedef enum rwlock_policy_e rwlock_policy;
+typedef struct timer_histogram_s timer_histogram;
+typedef enum sync_pool_affinity_e sync_pool_affinity;
+typedef struct sync_pool_s sync_pool;
+
+typedef struct
+{
+    uint64_t  acquires, contended;
+    timestamp wait_total, wait_max,
+              hold_total, hold_max;
+} sync_stats;
+
+typedef struct
+{
+    uint32_t _state;
+} fast_mutex;
+
+typedef struct
+{
+    uint32_t    _sequence, _waiters;
+    fast_mutex *p_fast_mutex;
+} fast_condition_variable;
+
+typedef struct
+{
+    uint32_t  _state, _count;
+    timestamp _spin, _hold, _acquired;
+} adaptive_mutex;
+
+typedef struct mcs_node_s
+{
+    struct mcs_node_s *p_next;
+    uint32_t           _locked;
+} __attribute__((aligned(64))) mcs_node;
+
+typedef struct
+{
+    mcs_node *p_tail;
+} mcs_spinlock;
+
+typedef struct
+{
+    uint32_t _next, _owner;
+} ticket_spinlock;
+
+typedef struct
+{
+    uint32_t _locked;
+} ttas_spinlock;
+
+typedef struct
+{
+    #ifdef BUILD_SYNC_WITH_STATS
+        sync_stats _stats;
+        timestamp  _acquired;
+    #endif
+    uint32_t      _lock, _readers_sequence, _writers_sequence;
+    uint32_t      _readers, _readers_waiting, _writers_waiting, _admit, _phase;
+    bool          _writer, _upgrading;
+    size_t        _upgrader;
+    rwlock_policy _policy;
+} rwlock;
+
+typedef struct
+{
+    uint32_t  _writer;
+    size_t    _slots;
+    void     *p_slots;
+} brlock;
+
+typedef struct
+{
+    #ifdef BUILD_SYNC_WITH_STATS
+        sync_stats _stats;
+    #endif
+    uint32_t _count, _waiters, _batch_waiters;
+} semaphore;
+
+typedef struct
+{
+    uint32_t  _lock;
+    uint64_t  _available, _capacity;
+    void     *p_head, *p_tail;
+} wsem;
+
+typedef struct
+{
+    uint32_t _sequence;
+} seqlock;
+
+typedef void (fn_rcu_callback)(void *p_value);
+typedef void (fn_hazptr_reclaim)(void *p_value);
+typedef bool (fn_monitor_predicate)(void *p_context);
+typedef void (fn_barrier_completion)(void *p_context);
+typedef double (fn_barrier_reduce)(double a, double b);
+typedef void (fn_sync_once)(void *p_parameter);
+typedef void (fn_sync_pool_task)(void *p_parameter);
+
+typedef struct
+{
+    uint64_t _state;
+} eventcount;
+
+typedef struct
+{
+    uint32_t               _phase, _sleepers;
+    unsigned int           _count;
+    size_t                 _leaves, _nodes;
+    void                  *p_nodes;
+    fn_barrier_completion *pfn_barrier_completion;
+    void                  *p_completion_context;
+    double                 _result;
+} barrier;
+
+typedef struct
+{
+    uint32_t _count;
+} latch;
+
+typedef struct
+{
+    uint32_t _state;
+} once_flag;
+
+typedef struct phaser_s
+{
+    uint64_t         _state;
+    uint32_t         _lock, _sleepers;
+    struct phaser_s *p_parent, *p_root;
+} phaser;
+
+typedef struct
+{
+    fast_mutex               _mutex;
+    fast_condition_variable  _queues[SYNC_MONITOR_QUEUES];
+    const char              *_names[SYNC_MONITOR_QUEUES];
+} monitor;
+
 // Platform dependent typedefs
 #ifdef _WIN64
     typedef HANDLE mutex;
-    typedef HANDLE semaphore;
     typedef HANDLE thread;
+#elif defined(BUILD_SYNC_WITH_STATS)
+    typedef struct
+    {
+        sync_stats      _stats;
+        timestamp       _acquired;
+        pthread_mutex_t _mutex;
+    } mutex;
+
+    typedef struct
+    {
+        sync_stats         _stats;
+        timestamp          _acquired;
+        pthread_spinlock_t _spinlock;
+    } spinlock;
+
+    typedef pthread_cond_t     condition_variable;
 #else
     typedef pthread_mutex_t    mutex;
     typedef pthread_spinlock_t spinlock;
-    typedef pthread_rwlock_t   rwlock;
-    typedef sem_t              semaphore;
     typedef pthread_cond_t     condition_variable;
-    typedef pthread_barrier_t  barrier;
-    typedef struct
-    {
-        pthread_mutex_t _mutex;
-        pthread_cond_t  _cond;
-    } monitor;
 
 #endif
 
-// Typedefs
-typedef signed timestamp;
-
 // Initializer
 /** !
  * This gets called at runtime before main. 
@@ -73,6 +255,10 @@ DLLEXPORT void sync_init ( void ) __attribute__((constructor));
  * and use the SYNC_TIMER_DIVISOR constant to convert 
  * time to seconds
  * 
+ * On x86 machines with an invariant TSC that is consistent
+ * across cores, this reads the TSC directly. Otherwise, 
+ * the monotonic clock is used.
+ * 
  * @param void
  * 
  * @sa timer_seconds_divisor
@@ -94,7 +280,66 @@ DLLEXPORT timestamp timer_high_precision ( void );
  * 
  * @return a constant integer for converting time to seconds
  */
-DLLEXPORT signed timer_seconds_divisor ( void );
+DLLEXPORT timestamp timer_seconds_divisor ( void );
+
+/** !
+ * Create a latency histogram. Buckets are log-linear, so 
+ * every recorded value is resolved to within ~3%.
+ * 
+ * @param pp_timer_histogram result
+ * 
+ * @sa timer_histogram_destroy
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int timer_histogram_create ( timer_histogram **pp_timer_histogram );
+
+/** !
+ * Record a difference of timestamps in a histogram. This is 
+ * wait-free; each thread records into its own shard.
+ * 
+ * @param p_timer_histogram the histogram
+ * @param _time             the difference of two timestamps
+ * 
+ * @sa timer_high_precision
+ * @sa timer_histogram_percentile
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int timer_histogram_record ( timer_histogram *p_timer_histogram, timestamp _time );
+
+/** !
+ * Add the contents of one histogram to another
+ * 
+ * @param p_timer_histogram the histogram to add to
+ * @param p_other           the histogram to add
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int timer_histogram_merge ( timer_histogram *p_timer_histogram, timer_histogram *p_other );
+
+/** !
+ * Get a percentile of the values recorded in a histogram
+ * 
+ * @param p_timer_histogram the histogram
+ * @param percentile        the percentile, from 0 to 100
+ * 
+ * @sa timer_histogram_record
+ * 
+ * @return the highest value equivalent to the percentile, or 0 if nothing was recorded
+ */
+DLLEXPORT timestamp timer_histogram_percentile ( timer_histogram *p_timer_histogram, double percentile );
+
+/** !
+ * Destroy a histogram
+ * 
+ * @param pp_timer_histogram pointer to the histogram
+ * 
+ * @sa timer_histogram_create
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int timer_histogram_destroy ( timer_histogram **pp_timer_histogram );
 #endif
 
 // Mutex
@@ -142,362 +387,1952 @@ DLLEXPORT int mutex_unlock ( mutex *p_mutex );
  * @return 1 on success, 0 on error
  */
 DLLEXPORT int mutex_destroy ( mutex *p_mutex );
-#endif
 
-// Spinlock
-#ifdef BUILD_SYNC_WITH_SPINLOCK
 /** !
- * Create a spinlock
+ * Create a fast mutex. A fast mutex is a 32-bit word. Locking and
+ * unlocking an uncontended fast mutex is one atomic operation, 
+ * inlined into the caller. Only contended operations call into 
+ * the library, where the thread sleeps on a futex.
  * 
- * @param p_spinlock result
+ * @param p_fast_mutex result
  * 
- * @sa spinlock_destroy
+ * @sa fast_mutex_destroy
  * 
  * @return 1 on success, 0 on error
-*/
-DLLEXPORT int spinlock_create ( spinlock *p_spinlock );
+ */
+DLLEXPORT int fast_mutex_create ( fast_mutex *p_fast_mutex );
 
 /** !
- * Lock a spinlock
+ * Lock a contended fast mutex. Don't call this directly.
  * 
- * @param p_spinlock the spinlock
+ * @param p_fast_mutex the fast mutex
  * 
- * @sa spinlock_unlock
+ * @sa fast_mutex_lock
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int spinlock_lock ( spinlock *p_spinlock );
+DLLEXPORT int fast_mutex_lock_slow ( fast_mutex *p_fast_mutex );
 
 /** !
- * Unlock a spinlock
+ * Wake a thread waiting on a fast mutex. Don't call this directly.
  * 
- * @param p_spinlock the spinlock
+ * @param p_fast_mutex the fast mutex
  * 
- * @sa spinlock_lock
+ * @sa fast_mutex_unlock
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int spinlock_unlock ( spinlock *p_spinlock );
+DLLEXPORT int fast_mutex_unlock_slow ( fast_mutex *p_fast_mutex );
 
 /** !
- * Free a spinlock
+ * Try to lock a fast mutex without waiting
  * 
- * @param p_spinlock the spinlock
+ * @param p_fast_mutex the fast mutex
  * 
- * @sa spinlock_create
+ * @sa fast_mutex_lock
  * 
- * @return 1 on success, 0 on error
+ * @return 1 if the mutex was locked, else 0
  */
-DLLEXPORT int spinlock_destroy ( spinlock *p_spinlock );
-#endif
+static inline int fast_mutex_try_lock ( fast_mutex *p_fast_mutex )
+{
+
+    // Initialized data
+    uint32_t expected = 0;
+
+    // Unlocked -> locked
+    return __atomic_compare_exchange_n(&p_fast_mutex->_state, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+}
 
-// Read Write Lock
-#ifdef BUILD_SYNC_WITH_RW_LOCK
 /** !
- * Create a read-write lock
+ * Lock a fast mutex
  * 
- * @param p_rwlock result
+ * @param p_fast_mutex the fast mutex
  * 
- * @sa rwlock_destroy
+ * @sa fast_mutex_unlock
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int rwlock_create ( rwlock *p_rwlock );
+static inline int fast_mutex_lock ( fast_mutex *p_fast_mutex )
+{
+
+    // Fast path
+    if ( fast_mutex_try_lock(p_fast_mutex) ) return 1;
+
+    // Slow path
+    return fast_mutex_lock_slow(p_fast_mutex);
+}
 
 /** !
- * Lock a reader
+ * Unlock a fast mutex
  * 
- * @param p_rwlock the read-write lock
+ * @param p_fast_mutex the fast mutex
  * 
- * @sa rwlock_lock_wr
- * @sa rwlock_lock_timeout_rd
- * @sa rwlock_lock_timeout_wr
- * @sa rwlock_unlock
+ * @sa fast_mutex_lock
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int rwlock_lock_rd ( rwlock *p_rwlock );
+static inline int fast_mutex_unlock ( fast_mutex *p_fast_mutex )
+{
+
+    // Fast path. Locked -> unlocked, with no waiters
+    if ( __atomic_exchange_n(&p_fast_mutex->_state, 0, __ATOMIC_RELEASE) == 1 ) return 1;
+
+    // Slow path
+    return fast_mutex_unlock_slow(p_fast_mutex);
+}
 
 /** !
- * Lock a writer
+ * Destroy a fast mutex
  * 
- * @param p_rwlock the read-write lock
+ * @param p_fast_mutex the fast mutex
  * 
- * @sa rwlock_lock_rd
- * @sa rwlock_lock_timeout_rd
- * @sa rwlock_lock_timeout_wr
- * @sa rwlock_unlock
+ * @sa fast_mutex_create
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int rwlock_lock_wr ( rwlock *p_rwlock );
+DLLEXPORT int fast_mutex_destroy ( fast_mutex *p_fast_mutex );
 
+#ifdef BUILD_SYNC_WITH_TIMER
 /** !
- * Lock a reader
+ * Create an adaptive mutex. A thread that finds an adaptive mutex
+ * locked spins before it parks. Each mutex learns how long it is 
+ * held, and spins for about twice that, so short critical sections
+ * never sleep, and long critical sections don't burn the processor.
+ * Hold times are sampled on one in every 16 acquisitions.
  * 
- * @param p_rwlock the read-write lock
- * @param _time    the quantity of time to wait, in nanoseconds 
+ * @param p_adaptive_mutex result
  * 
- * @sa rwlock_lock_wr
- * @sa rwlock_lock_timeout_wr
- * @sa rwlock_unlock
+ * @sa adaptive_mutex_destroy
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int rwlock_lock_timeout_rd ( rwlock *p_rwlock, timestamp _time );
+DLLEXPORT int adaptive_mutex_create ( adaptive_mutex *p_adaptive_mutex );
 
 /** !
- * Lock a writer
+ * Lock an adaptive mutex
  * 
- * @param p_rwlock the read-write lock
- * @param _time    the quantity of time to wait, in nanoseconds 
+ * @param p_adaptive_mutex the adaptive mutex
  * 
- * @sa rwlock_lock_rd
- * @sa rwlock_lock_timeout_rd
- * @sa rwlock_unlock
+ * @sa adaptive_mutex_unlock
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int rwlock_lock_timeout_wr ( rwlock *p_rwlock, timestamp _time );
+DLLEXPORT int adaptive_mutex_lock ( adaptive_mutex *p_adaptive_mutex );
 
 /** !
- * Unlock a read-write lock
+ * Unlock an adaptive mutex, and update its spin budget
  * 
- * @param p_rwlock the read-write lock
+ * @param p_adaptive_mutex the adaptive mutex
  * 
- * @sa rwlock_lock_rd
- * @sa rwlock_lock_wr
+ * @sa adaptive_mutex_lock
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int rwlock_unlock ( rwlock *p_rwlock );
+DLLEXPORT int adaptive_mutex_unlock ( adaptive_mutex *p_adaptive_mutex );
 
 /** !
- * Destroy a read-write lock
+ * Destroy an adaptive mutex
  * 
- * @param p_rwlock the read-write lock
+ * @param p_adaptive_mutex the adaptive mutex
  * 
- * @sa rwlock_create
+ * @sa adaptive_mutex_create
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int rwlock_destroy ( rwlock *p_rwlock );
+DLLEXPORT int adaptive_mutex_destroy ( adaptive_mutex *p_adaptive_mutex );
+#endif
 #endif
 
-// Semaphore
-#ifdef BUILD_SYNC_WITH_SEMAPHORE
+// Spinlock
+#ifdef BUILD_SYNC_WITH_SPINLOCK
 /** !
- * Create a semaphore
+ * Create a spinlock
  * 
- * @param p_semaphore result
- * @param count       the initial count
+ * @param p_spinlock result
  * 
- * @sa semaphore_destroy
+ * @sa spinlock_destroy
  * 
  * @return 1 on success, 0 on error
- */
-DLLEXPORT int semaphore_create ( semaphore *p_semaphore, unsigned int count );
+*/
+DLLEXPORT int spinlock_create ( spinlock *p_spinlock );
 
 /** !
- * Wait on a semaphore
+ * Lock a spinlock
  * 
- * @param _semaphore the semaphore
+ * @param p_spinlock the spinlock
  * 
- * @sa semaphore_signal
+ * @sa spinlock_unlock
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int semaphore_wait ( semaphore _semaphore );
+DLLEXPORT int spinlock_lock ( spinlock *p_spinlock );
 
 /** !
- * Signal a semaphore
+ * Unlock a spinlock
  * 
- * @param _semaphore the semaphore
+ * @param p_spinlock the spinlock
  * 
- * @sa semaphore_wait
+ * @sa spinlock_lock
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int semaphore_signal ( semaphore _semaphore );
+DLLEXPORT int spinlock_unlock ( spinlock *p_spinlock );
 
 /** !
- * Free a semaphore
+ * Free a spinlock
  * 
- * @param p_semaphore the semaphore
+ * @param p_spinlock the spinlock
  * 
- * @sa semaphore_create
+ * @sa spinlock_create
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int semaphore_destroy ( semaphore *p_semaphore );
-#endif
+DLLEXPORT int spinlock_destroy ( spinlock *p_spinlock );
 
-// Condition variable
-#ifdef BUILD_SYNC_WITH_CONDITION_VARIABLE
 /** !
- * Create a condition variable
+ * Create an MCS spinlock. Waiters form a queue, and each waiter 
+ * spins on its own node, so a contended MCS spinlock doesn't 
+ * bounce a shared cache line between processors. The lock is 
+ * handed to waiters in FIFO order.
  * 
- * @param p_condition_variable result
+ * @param p_mcs_spinlock result
  * 
- * @sa condition_variable_destroy
+ * @sa mcs_spinlock_destroy
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int condition_variable_create ( condition_variable *p_condition_variable );
+DLLEXPORT int mcs_spinlock_create ( mcs_spinlock *p_mcs_spinlock );
 
 /** !
- * Wait on a condition variable
+ * Lock an MCS spinlock
  * 
- * @param p_condition_variable the condition variable
- * @param p_mutex              the mutex
+ * @param p_mcs_spinlock the MCS spinlock
+ * @param p_mcs_node     a queue node, owned by the caller until the lock is unlocked
  * 
- * @sa condition_variable_wait_timeout
+ * @sa mcs_spinlock_unlock
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int condition_variable_wait ( condition_variable *p_condition_variable, mutex *p_mutex );
+DLLEXPORT int mcs_spinlock_lock ( mcs_spinlock *p_mcs_spinlock, mcs_node *p_mcs_node );
 
 /** !
- * Wait on a condition variable with some timeout
+ * Unlock an MCS spinlock
  * 
- * @param p_condition_variable the condition variable
- * @param p_mutex              the mutex
- * @param _time                the quantity of time to wait, in nanoseconds
+ * @param p_mcs_spinlock the MCS spinlock
+ * @param p_mcs_node     the queue node that was used to lock the spinlock
  * 
- * @sa condition_variable_wait
+ * @sa mcs_spinlock_lock
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int condition_variable_wait_timeout ( condition_variable *p_condition_variable, mutex *p_mutex, timestamp _time );
+DLLEXPORT int mcs_spinlock_unlock ( mcs_spinlock *p_mcs_spinlock, mcs_node *p_mcs_node );
 
 /** !
- * Signal once thread
+ * Destroy an MCS spinlock
  * 
- * @param p_condition_variable the condition variable
+ * @param p_mcs_spinlock the MCS spinlock
  * 
- * @sa condition_variable_broadcast
+ * @sa mcs_spinlock_create
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int condition_variable_signal ( condition_variable *const p_condition_variable );
+DLLEXPORT int mcs_spinlock_destroy ( mcs_spinlock *p_mcs_spinlock );
 
 /** !
- * Signal all threads
+ * Create a ticket spinlock. A ticket spinlock is 8 bytes, and
+ * serves waiters in FIFO order, which bounds their tail latency.
  * 
- * @param p_condition_variable the condition variable
+ * @param p_ticket_spinlock result
  * 
- * @sa condition_variable_signal
+ * @sa ticket_spinlock_destroy
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int condition_variable_broadcast ( condition_variable *const p_condition_variable );
+DLLEXPORT int ticket_spinlock_create ( ticket_spinlock *p_ticket_spinlock );
 
 /** !
- * Destroy a condition variable
+ * Wait for a ticket to be served. Don't call this directly.
  * 
- * @param p_condition_variable the condition variable
+ * @param p_ticket_spinlock the ticket spinlock
+ * @param ticket            the ticket
  * 
- * @sa condition_variable_create
+ * @sa ticket_spinlock_lock
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int condition_variable_destroy ( condition_variable *p_condition_variable );
-#endif
+DLLEXPORT int ticket_spinlock_lock_slow ( ticket_spinlock *p_ticket_spinlock, uint32_t ticket );
 
-// Monitor
-#ifdef BUILD_SYNC_WITH_MONITOR
 /** !
- * Create a monitor
+ * Lock a ticket spinlock
  * 
- * @param p_monitor result
+ * @param p_ticket_spinlock the ticket spinlock
  * 
- * @sa monitor_destroy
+ * @sa ticket_spinlock_unlock
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int monitor_create ( monitor *p_monitor );
+static inline int ticket_spinlock_lock ( ticket_spinlock *p_ticket_spinlock )
+{
+
+    // Initialized data
+    uint32_t ticket = __atomic_fetch_add(&p_ticket_spinlock->_next, 1, __ATOMIC_RELAXED);
+
+    // Fast path
+    if ( __atomic_load_n(&p_ticket_spinlock->_owner, __ATOMIC_ACQUIRE) == ticket ) return 1;
+
+    // Slow path
+    return ticket_spinlock_lock_slow(p_ticket_spinlock, ticket);
+}
 
 /** !
- * Wait on a monitor
+ * Unlock a ticket spinlock
  * 
- * @param p_monitor the monitor
+ * @param p_ticket_spinlock the ticket spinlock
  * 
- * @sa monitor_notify
- * @sa monitor_notify_all
+ * @sa ticket_spinlock_lock
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int monitor_wait ( monitor *p_monitor );
+static inline int ticket_spinlock_unlock ( ticket_spinlock *p_ticket_spinlock )
+{
+
+    // Serve the next ticket. Only the owner writes this
+    __atomic_store_n(&p_ticket_spinlock->_owner, p_ticket_spinlock->_owner + 1, __ATOMIC_RELEASE);
+
+    // Success
+    return 1;
+}
 
 /** !
- * Signal one thread
+ * Destroy a ticket spinlock
  * 
- * @param p_monitor the monitor
+ * @param p_ticket_spinlock the ticket spinlock
  * 
- * @sa monitor_wait
- * @sa monitor_notify_all
+ * @sa ticket_spinlock_create
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int monitor_notify ( monitor *p_monitor );
+DLLEXPORT int ticket_spinlock_destroy ( ticket_spinlock *p_ticket_spinlock );
 
 /** !
- * Signal all threads
+ * Create a test and test and set spinlock. A TTAS spinlock is 
+ * 4 bytes. Waiters spin on a shared copy of the lock, and back 
+ * off exponentially when they lose a race for it, which gives
+ * the best throughput when contention is low.
  * 
- * @param p_monitor the monitor
+ * @param p_ttas_spinlock result
  * 
- * @sa monitor_wait
- * @sa monitor_notify
+ * @sa ttas_spinlock_destroy
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int monitor_notify_all ( monitor *p_monitor );
+DLLEXPORT int ttas_spinlock_create ( ttas_spinlock *p_ttas_spinlock );
 
 /** !
- * Free a monitor
+ * Lock a contended TTAS spinlock. Don't call this directly.
  * 
- * @param p_monitor the monitor
+ * @param p_ttas_spinlock the TTAS spinlock
  * 
- * @sa monitor_create
+ * @sa ttas_spinlock_lock
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int monitor_destroy ( monitor *p_monitor );
-#endif
+DLLEXPORT int ttas_spinlock_lock_slow ( ttas_spinlock *p_ttas_spinlock );
 
-// Barrier
-#ifdef BUILD_SYNC_WITH_BARRIER
 /** !
- * Create a barrier
+ * Try to lock a TTAS spinlock without waiting
  * 
- * @param p_barrier result
- * @param count     the quantity of threads that must wait at the barrier
+ * @param p_ttas_spinlock the TTAS spinlock
  * 
- * @sa barrier_destroy
+ * @sa ttas_spinlock_lock
  * 
- * @return 1 on success, 0 on error
+ * @return 1 if the spinlock was locked, else 0
  */
-DLLEXPORT int barrier_create ( barrier *p_barrier, unsigned int count );
+static inline int ttas_spinlock_try_lock ( ttas_spinlock *p_ttas_spinlock )
+{
+
+    // Test, then test and set
+    return ( __atomic_load_n(&p_ttas_spinlock->_locked, __ATOMIC_RELAXED) == 0 ) && ( __atomic_exchange_n(&p_ttas_spinlock->_locked, 1, __ATOMIC_ACQUIRE) == 0 );
+}
 
 /** !
- * Wait at a barrier
+ * Lock a TTAS spinlock
  * 
- * @param p_barrier the barrier
+ * @param p_ttas_spinlock the TTAS spinlock
+ * 
+ * @sa ttas_spinlock_unlock
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int barrier_wait ( barrier *p_barrier );
+static inline int ttas_spinlock_lock ( ttas_spinlock *p_ttas_spinlock )
+{
+
+    // Fast path
+    if ( ttas_spinlock_try_lock(p_ttas_spinlock) ) return 1;
+
+    // Slow path
+    return ttas_spinlock_lock_slow(p_ttas_spinlock);
+}
 
 /** !
- * Destroy a barrier
+ * Unlock a TTAS spinlock
  * 
- * @param p_barrier the barrier
+ * @param p_ttas_spinlock the TTAS spinlock
+ * 
+ * @sa ttas_spinlock_lock
+ * 
+ * @return 1 on success, 0 on error
+ */
+static inline int ttas_spinlock_unlock ( ttas_spinlock *p_ttas_spinlock )
+{
+
+    // Unlock
+    __atomic_store_n(&p_ttas_spinlock->_locked, 0, __ATOMIC_RELEASE);
+
+    // Success
+    return 1;
+}
+
+/** !
+ * Destroy a TTAS spinlock
+ * 
+ * @param p_ttas_spinlock the TTAS spinlock
+ * 
+ * @sa ttas_spinlock_create
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int ttas_spinlock_destroy ( ttas_spinlock *p_ttas_spinlock );
+#endif
+
+// Read Write Lock
+#ifdef BUILD_SYNC_WITH_RW_LOCK
+/** !
+ * Create a read-write lock that prefers readers
+ * 
+ * @param p_rwlock result
+ * 
+ * @sa rwlock_create_policy
+ * @sa rwlock_destroy
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int rwlock_create ( rwlock *p_rwlock );
+
+/** !
+ * Create a read-write lock with a policy. A reader preferring lock
+ * admits readers whenever no writer holds it, so a steady stream
+ * of readers can starve writers. A writer preferring lock holds 
+ * new readers back while writers wait. A phase fair lock alternates
+ * between writers and the readers that queued behind them, so 
+ * neither side starves.
+ * 
+ * @param p_rwlock result
+ * @param policy   SYNC_RWLOCK_PREFER_READER, SYNC_RWLOCK_PREFER_WRITER, or SYNC_RWLOCK_PHASE_FAIR
+ * 
+ * @sa rwlock_create
+ * @sa rwlock_destroy
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int rwlock_create_policy ( rwlock *p_rwlock, rwlock_policy policy );
+
+/** !
+ * Lock a reader
+ * 
+ * @param p_rwlock the read-write lock
+ * 
+ * @sa rwlock_lock_wr
+ * @sa rwlock_lock_timeout_rd
+ * @sa rwlock_lock_timeout_wr
+ * @sa rwlock_unlock
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int rwlock_lock_rd ( rwlock *p_rwlock );
+
+/** !
+ * Lock a writer
+ * 
+ * @param p_rwlock the read-write lock
+ * 
+ * @sa rwlock_lock_rd
+ * @sa rwlock_lock_timeout_rd
+ * @sa rwlock_lock_timeout_wr
+ * @sa rwlock_unlock
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int rwlock_lock_wr ( rwlock *p_rwlock );
+
+/** !
+ * Lock a reader
+ * 
+ * @param p_rwlock the read-write lock
+ * @param _time    the quantity of time to wait, in nanoseconds 
+ * 
+ * @sa rwlock_lock_wr
+ * @sa rwlock_lock_timeout_wr
+ * @sa rwlock_unlock
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int rwlock_lock_timeout_rd ( rwlock *p_rwlock, timestamp _time );
+
+/** !
+ * Lock a writer
+ * 
+ * @param p_rwlock the read-write lock
+ * @param _time    the quantity of time to wait, in nanoseconds 
+ * 
+ * @sa rwlock_lock_rd
+ * @sa rwlock_lock_timeout_rd
+ * @sa rwlock_unlock
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int rwlock_lock_timeout_wr ( rwlock *p_rwlock, timestamp _time );
+
+/** !
+ * Lock an upgradable reader. An upgradable reader shares the lock
+ * with readers, but excludes writers and other upgradable readers,
+ * so it can check a condition, then upgrade, without racing.
+ * 
+ * @param p_rwlock the read-write lock
+ * 
+ * @sa rwlock_upgrade
+ * @sa rwlock_unlock
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int rwlock_lock_upgradable ( rwlock *p_rwlock );
+
+/** !
+ * Upgrade an upgradable reader to a writer. Waits for the other
+ * readers to unlock, and holds new readers back.
+ * 
+ * @param p_rwlock the read-write lock
+ * 
+ * @sa rwlock_lock_upgradable
+ * @sa rwlock_downgrade
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int rwlock_upgrade ( rwlock *p_rwlock );
+
+/** !
+ * Downgrade a writer to a reader, without unlocking
+ * 
+ * @param p_rwlock the read-write lock
+ * 
+ * @sa rwlock_upgrade
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int rwlock_downgrade ( rwlock *p_rwlock );
+
+/** !
+ * Unlock a read-write lock
+ * 
+ * @param p_rwlock the read-write lock
+ * 
+ * @sa rwlock_lock_rd
+ * @sa rwlock_lock_wr
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int rwlock_unlock ( rwlock *p_rwlock );
+
+/** !
+ * Destroy a read-write lock
+ * 
+ * @param p_rwlock the read-write lock
+ * 
+ * @sa rwlock_create
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int rwlock_destroy ( rwlock *p_rwlock );
+
+/** !
+ * Create a big reader lock. A big reader lock has a cache line 
+ * padded reader slot for each processor. Readers only touch their
+ * own slot, so read-mostly data scales with the quantity of cores.
+ * Writers sweep every slot, so writing is expensive.
+ * 
+ * @param p_brlock result
+ * 
+ * @sa brlock_destroy
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int brlock_create ( brlock *p_brlock );
+
+/** !
+ * Lock a reader. The reader counts itself in the slot of the calling
+ * thread, so it must unlock on the same thread.
+ * 
+ * @param p_brlock the big reader lock
+ * 
+ * @sa brlock_unlock_rd
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int brlock_lock_rd ( brlock *p_brlock );
+
+/** !
+ * Unlock a reader. Call this on the thread that locked the reader.
+ * 
+ * @param p_brlock the big reader lock
+ * 
+ * @sa brlock_lock_rd
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int brlock_unlock_rd ( brlock *p_brlock );
+
+/** !
+ * Lock a writer
+ * 
+ * @param p_brlock the big reader lock
+ * 
+ * @sa brlock_unlock_wr
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int brlock_lock_wr ( brlock *p_brlock );
+
+/** !
+ * Unlock a writer
+ * 
+ * @param p_brlock the big reader lock
+ * 
+ * @sa brlock_lock_wr
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int brlock_unlock_wr ( brlock *p_brlock );
+
+/** !
+ * Destroy a big reader lock. The lock must not be held.
+ * 
+ * @param p_brlock the big reader lock
+ * 
+ * @sa brlock_create
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int brlock_destroy ( brlock *p_brlock );
+#endif
+
+// Sequence lock
+#ifdef BUILD_SYNC_WITH_SEQLOCK
+
+/** !
+ * Create a sequence lock. A sequence lock protects small, 
+ * copyable data with one writer and many readers. Readers never
+ * write to shared memory, and never block the writer. Instead, 
+ * they copy the data, and retry if a write overlapped the copy.
+ * 
+ * Writers must be serialized by the caller. Readers must not 
+ * follow pointers out of the copy until it has been validated.
+ * 
+ * @param p_seqlock result
+ * 
+ * @sa seqlock_destroy
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int seqlock_create ( seqlock *p_seqlock );
+
+/** !
+ * Begin a write. The sequence is odd until the write ends
+ * 
+ * @param p_seqlock the sequence lock
+ * 
+ * @sa seqlock_write_end
+ * 
+ * @return 1 on success, 0 on error
+ */
+static inline int seqlock_write_begin ( seqlock *p_seqlock )
+{
+
+    // Mark the write in progress. Only the writer stores the sequence
+    __atomic_store_n(&p_seqlock->_sequence, p_seqlock->_sequence + 1, __ATOMIC_RELAXED);
+
+    // Order the mark before the writes to the data
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    // Success
+    return 1;
+}
+
+/** !
+ * End a write
+ * 
+ * @param p_seqlock the sequence lock
+ * 
+ * @sa seqlock_write_begin
+ * 
+ * @return 1 on success, 0 on error
+ */
+static inline int seqlock_write_end ( seqlock *p_seqlock )
+{
+
+    // Publish the writes to the data
+    __atomic_store_n(&p_seqlock->_sequence, p_seqlock->_sequence + 1, __ATOMIC_RELEASE);
+
+    // Success
+    return 1;
+}
+
+/** !
+ * Begin a read
+ * 
+ * @param p_seqlock the sequence lock
+ * 
+ * @sa seqlock_read_retry
+ * 
+ * @return the sequence to pass to seqlock_read_retry
+ */
+static inline uint32_t seqlock_read_begin ( const seqlock *p_seqlock )
+{
+
+    // Clear the low bit, so a read that overlaps a write always retries
+    return __atomic_load_n(&p_seqlock->_sequence, __ATOMIC_ACQUIRE) & ~(uint32_t)1;
+}
+
+/** !
+ * End a read, and check if it must be retried
+ * 
+ * @param p_seqlock the sequence lock
+ * @param sequence  the return value of seqlock_read_begin
+ * 
+ * @sa seqlock_read_begin
+ * 
+ * @return true if a write overlapped the read, else false
+ */
+static inline bool seqlock_read_retry ( const seqlock *p_seqlock, uint32_t sequence )
+{
+
+    // Order the reads of the data before the check
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+    // Check for a write
+    return __atomic_load_n(&p_seqlock->_sequence, __ATOMIC_RELAXED) != sequence;
+}
+
+/** !
+ * Destroy a sequence lock
+ * 
+ * @param p_seqlock the sequence lock
+ * 
+ * @sa seqlock_create
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int seqlock_destroy ( seqlock *p_seqlock );
+#endif
+
+// Read copy update
+#ifdef BUILD_SYNC_WITH_RCU
+
+/** !
+ * Enter a read side critical section. Readers only write to their
+ * own cache line, so read side critical sections scale with the
+ * quantity of cores. Critical sections nest, and must not block.
+ * 
+ * @param void
+ * 
+ * @sa rcu_read_unlock
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int rcu_read_lock ( void );
+
+/** !
+ * Leave a read side critical section
+ * 
+ * @param void
+ * 
+ * @sa rcu_read_lock
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int rcu_read_unlock ( void );
+
+/** !
+ * Wait for a grace period. When this returns, every read side 
+ * critical section that began before the call has ended. Don't 
+ * call this from a read side critical section.
+ * 
+ * @param void
+ * 
+ * @sa rcu_call
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int rcu_synchronize ( void );
+
+/** !
+ * Defer a callback until after a grace period. Callbacks are 
+ * batched per thread, so one grace period is amortized over 
+ * many callbacks.
+ * 
+ * @param pfn_rcu_callback the callback, e.g. free
+ * @param p_value          the parameter of the callback
+ * 
+ * @sa rcu_barrier
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int rcu_call ( fn_rcu_callback *pfn_rcu_callback, void *p_value );
+
+/** !
+ * Wait for a grace period, and run the calling thread's deferred 
+ * callbacks. Don't call this from a read side critical section.
+ * 
+ * @param void
+ * 
+ * @sa rcu_call
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int rcu_barrier ( void );
+#endif
+
+// Hazard pointers
+#ifdef BUILD_SYNC_WITH_HAZARD_POINTER
+
+/** !
+ * Protect a shared pointer from reclamation. Each thread has 
+ * SYNC_HAZPTR_SLOTS hazard slots. The protected pointer is safe
+ * to dereference until its slot is cleared, or reused.
+ * 
+ * @param pp_source the shared pointer
+ * @param index     the hazard slot
+ * 
+ * @sa hazptr_clear
+ * 
+ * @return the protected pointer on success, null pointer on error
+ */
+DLLEXPORT void *hazptr_protect ( void *const *pp_source, size_t index );
+
+/** !
+ * Clear a hazard slot
+ * 
+ * @param index the hazard slot
+ * 
+ * @sa hazptr_protect
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int hazptr_clear ( size_t index );
+
+/** !
+ * Retire a pointer that has been removed from a shared structure.
+ * The pointer is reclaimed once no hazard slot protects it. Scans
+ * are amortized over many retirements, and unreclaimed pointers 
+ * are bounded by the quantity of hazard slots, even if a reader 
+ * stalls.
+ * 
+ * @param p_value              the pointer
+ * @param pfn_hazptr_reclaim   the reclaim function, e.g. free
+ * 
+ * @sa hazptr_scan
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int hazptr_retire ( void *p_value, fn_hazptr_reclaim *pfn_hazptr_reclaim );
+
+/** !
+ * Reclaim every retired pointer of the calling thread that is 
+ * not protected
+ * 
+ * @param void
+ * 
+ * @sa hazptr_retire
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int hazptr_scan ( void );
+#endif
+
+// Semaphore
+#ifdef BUILD_SYNC_WITH_SEMAPHORE
+/** !
+ * Create a semaphore. The count lives in user space, so waits and
+ * signals only enter the kernel to sleep, or to wake a sleeper.
+ * 
+ * @param p_semaphore result
+ * @param count       the initial count
+ * 
+ * @sa semaphore_destroy
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int semaphore_create ( semaphore *p_semaphore, unsigned int count );
+
+/** !
+ * Wait on a semaphore
+ * 
+ * @param p_semaphore the semaphore
+ * 
+ * @sa semaphore_signal
+ * @sa semaphore_wait_n
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int semaphore_wait ( semaphore *p_semaphore );
+
+/** !
+ * Wait on a semaphore until a quantity of units can be taken at once
+ * 
+ * @param p_semaphore the semaphore
+ * @param n           the quantity of units
+ * 
+ * @sa semaphore_signal_n
+ * @sa semaphore_wait
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int semaphore_wait_n ( semaphore *p_semaphore, unsigned int n );
+
+/** !
+ * Signal a semaphore
+ * 
+ * @param p_semaphore the semaphore
+ * 
+ * @sa semaphore_wait
+ * @sa semaphore_signal_n
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int semaphore_signal ( semaphore *p_semaphore );
+
+/** !
+ * Signal a semaphore a quantity of times. Up to n waiters are woken
+ * with one system call.
+ * 
+ * @param p_semaphore the semaphore
+ * @param n           the quantity of units
+ * 
+ * @sa semaphore_wait_n
+ * @sa semaphore_signal
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int semaphore_signal_n ( semaphore *p_semaphore, unsigned int n );
+
+/** !
+ * Free a semaphore
+ * 
+ * @param p_semaphore the semaphore
+ * 
+ * @sa semaphore_create
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int semaphore_destroy ( semaphore *p_semaphore );
+
+/** !
+ * Create a weighted semaphore. A weighted semaphore hands out 
+ * arbitrary quantities of permits, e.g. bytes of buffer memory. 
+ * Waiters are served in FIFO order, so small requests can't 
+ * starve a large request at the head of the queue.
+ * 
+ * @param p_wsem  result
+ * @param permits the quantity of permits
+ * 
+ * @sa wsem_destroy
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int wsem_create ( wsem *p_wsem, uint64_t permits );
+
+/** !
+ * Acquire permits from a weighted semaphore
+ * 
+ * @param p_wsem  the weighted semaphore
+ * @param permits the quantity of permits
+ * 
+ * @sa wsem_try_acquire
+ * @sa wsem_release
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int wsem_acquire ( wsem *p_wsem, uint64_t permits );
+
+/** !
+ * Acquire permits from a weighted semaphore, without waiting
+ * 
+ * @param p_wsem  the weighted semaphore
+ * @param permits the quantity of permits
+ * 
+ * @sa wsem_acquire
+ * @sa wsem_release
+ * 
+ * @return 1 if the permits were acquired, else 0
+ */
+DLLEXPORT int wsem_try_acquire ( wsem *p_wsem, uint64_t permits );
+
+/** !
+ * Release permits to a weighted semaphore, and wake the waiters 
+ * at the head of the queue that can be satisfied. Releasing more
+ * permits than were acquired is an error.
+ * 
+ * @param p_wsem  the weighted semaphore
+ * @param permits the quantity of permits
+ * 
+ * @sa wsem_acquire
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int wsem_release ( wsem *p_wsem, uint64_t permits );
+
+/** !
+ * Destroy a weighted semaphore
+ * 
+ * @param p_wsem the weighted semaphore
+ * 
+ * @sa wsem_create
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int wsem_destroy ( wsem *p_wsem );
+#endif
+
+// Condition variable
+#ifdef BUILD_SYNC_WITH_CONDITION_VARIABLE
+/** !
+ * Create a condition variable
+ * 
+ * @param p_condition_variable result
+ * 
+ * @sa condition_variable_destroy
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int condition_variable_create ( condition_variable *p_condition_variable );
+
+/** !
+ * Wait on a condition variable
+ * 
+ * @param p_condition_variable the condition variable
+ * @param p_mutex              the mutex
+ * 
+ * @sa condition_variable_wait_timeout
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int condition_variable_wait ( condition_variable *p_condition_variable, mutex *p_mutex );
+
+/** !
+ * Wait on a condition variable with some timeout
+ * 
+ * @param p_condition_variable the condition variable
+ * @param p_mutex              the mutex
+ * @param _time                the quantity of time to wait, in nanoseconds
+ * 
+ * @sa condition_variable_wait
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int condition_variable_wait_timeout ( condition_variable *p_condition_variable, mutex *p_mutex, timestamp _time );
+
+/** !
+ * Signal once thread
+ * 
+ * @param p_condition_variable the condition variable
+ * 
+ * @sa condition_variable_broadcast
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int condition_variable_signal ( condition_variable *const p_condition_variable );
+
+/** !
+ * Signal all threads
+ * 
+ * @param p_condition_variable the condition variable
+ * 
+ * @sa condition_variable_signal
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int condition_variable_broadcast ( condition_variable *const p_condition_variable );
+
+/** !
+ * Destroy a condition variable
+ * 
+ * @param p_condition_variable the condition variable
+ * 
+ * @sa condition_variable_create
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int condition_variable_destroy ( condition_variable *p_condition_variable );
+
+// Fast condition variable
+#ifdef BUILD_SYNC_WITH_MUTEX
+/** !
+ * Create a fast condition variable. A fast condition variable is 
+ * paired with a fast mutex. Broadcasts wake one waiter, and move 
+ * the rest straight onto the mutex, so the waiters wake one at a 
+ * time as the mutex is handed off, instead of all at once.
+ * 
+ * @param p_fast_condition_variable result
+ * 
+ * @sa fast_condition_variable_destroy
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int fast_condition_variable_create ( fast_condition_variable *p_fast_condition_variable );
+
+/** !
+ * Wait on a fast condition variable. The wait may return 
+ * spuriously; callers must recheck their condition.
+ * 
+ * @param p_fast_condition_variable the fast condition variable
+ * @param p_fast_mutex              the locked fast mutex
+ * 
+ * @sa fast_condition_variable_wait_timeout
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int fast_condition_variable_wait ( fast_condition_variable *p_fast_condition_variable, fast_mutex *p_fast_mutex );
+
+/** !
+ * Wait on a fast condition variable with some timeout
+ * 
+ * @param p_fast_condition_variable the fast condition variable
+ * @param p_fast_mutex              the locked fast mutex
+ * @param _time                     the quantity of time to wait, in nanoseconds
+ * 
+ * @sa fast_condition_variable_wait
+ * 
+ * @return 1 if woken, 0 on timeout or error
+ */
+DLLEXPORT int fast_condition_variable_wait_timeout ( fast_condition_variable *p_fast_condition_variable, fast_mutex *p_fast_mutex, timestamp _time );
+
+/** !
+ * Wake one waiter
+ * 
+ * @param p_fast_condition_variable the fast condition variable
+ * 
+ * @sa fast_condition_variable_broadcast
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int fast_condition_variable_signal ( fast_condition_variable *p_fast_condition_variable );
+
+/** !
+ * Wake one waiter, and requeue the rest onto the fast mutex
+ * 
+ * @param p_fast_condition_variable the fast condition variable
+ * 
+ * @sa fast_condition_variable_signal
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int fast_condition_variable_broadcast ( fast_condition_variable *p_fast_condition_variable );
+
+/** !
+ * Destroy a fast condition variable
+ * 
+ * @param p_fast_condition_variable the fast condition variable
+ * 
+ * @sa fast_condition_variable_create
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int fast_condition_variable_destroy ( fast_condition_variable *p_fast_condition_variable );
+#endif
+#endif
+
+// Monitor
+#ifdef BUILD_SYNC_WITH_MONITOR
+/** !
+ * Create a monitor. A monitor is a fast mutex with condition 
+ * queues. Queue 0 is the default queue; up to SYNC_MONITOR_QUEUES - 1
+ * more queues can be named, e.g. "not_full" and "not_empty", so 
+ * notifies only wake threads that can make progress.
+ * 
+ * @param p_monitor result
+ * 
+ * @sa monitor_destroy
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int monitor_create ( monitor *p_monitor );
+
+/** !
+ * Get the index of a named condition queue, adding the queue if
+ * it doesn't exist. The name is not copied, and must outlive the 
+ * monitor.
+ * 
+ * @param p_monitor the monitor
+ * @param name      the name of the queue
+ * @param p_queue   return
+ * 
+ * @sa monitor_wait_until
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int monitor_queue ( monitor *p_monitor, const char *name, size_t *p_queue );
+
+/** !
+ * Enter a monitor
+ * 
+ * @param p_monitor the monitor
+ * 
+ * @sa monitor_exit
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int monitor_enter ( monitor *p_monitor );
+
+/** !
+ * Exit a monitor
+ * 
+ * @param p_monitor the monitor
+ * 
+ * @sa monitor_enter
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int monitor_exit ( monitor *p_monitor );
+
+/** !
+ * Wait on a condition queue until a predicate holds. The caller 
+ * must be inside the monitor. The predicate is checked inside the
+ * monitor, before each wait, so spurious and stale wakeups are 
+ * absorbed here.
+ * 
+ * @param p_monitor             the monitor
+ * @param queue                 the condition queue
+ * @param pfn_monitor_predicate the predicate
+ * @param p_context             the parameter of the predicate
+ * 
+ * @sa monitor_notify_queue
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int monitor_wait_until ( monitor *p_monitor, size_t queue, fn_monitor_predicate *pfn_monitor_predicate, void *p_context );
+
+/** !
+ * Enter a monitor, wait once on the default queue, then exit
+ * 
+ * @param p_monitor the monitor
+ * 
+ * @sa monitor_wait_until
+ * @sa monitor_notify
+ * @sa monitor_notify_all
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int monitor_wait ( monitor *p_monitor );
+
+/** !
+ * Signal one thread on the default queue
+ * 
+ * @param p_monitor the monitor
+ * 
+ * @sa monitor_wait
+ * @sa monitor_notify_all
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int monitor_notify ( monitor *p_monitor );
+
+/** !
+ * Signal all threads on the default queue
+ * 
+ * @param p_monitor the monitor
+ * 
+ * @sa monitor_wait
+ * @sa monitor_notify
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int monitor_notify_all ( monitor *p_monitor );
+
+/** !
+ * Signal one thread on a condition queue
+ * 
+ * @param p_monitor the monitor
+ * @param queue     the condition queue
+ * 
+ * @sa monitor_wait_until
+ * @sa monitor_notify_all_queue
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int monitor_notify_queue ( monitor *p_monitor, size_t queue );
+
+/** !
+ * Signal all threads on a condition queue
+ * 
+ * @param p_monitor the monitor
+ * @param queue     the condition queue
+ * 
+ * @sa monitor_wait_until
+ * @sa monitor_notify_queue
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int monitor_notify_all_queue ( monitor *p_monitor, size_t queue );
+
+/** !
+ * Free a monitor
+ * 
+ * @param p_monitor the monitor
+ * 
+ * @sa monitor_create
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int monitor_destroy ( monitor *p_monitor );
+#endif
+
+// Barrier
+#ifdef BUILD_SYNC_WITH_BARRIER
+/** !
+ * Create a barrier. Threads arrive at the leaves of a combining 
+ * tree, so no cache line sees more than a few arrivals. The last
+ * thread to arrive at a node carries the arrival up to its parent.
+ * The last thread to arrive at the root flips the phase, which is
+ * the sense of the barrier, and releases everyone at once. Waiters
+ * spin briefly, then park on the phase.
+ * 
+ * @param p_barrier result
+ * @param count     the quantity of threads that must wait at the barrier
+ * 
+ * @sa barrier_destroy
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int barrier_create ( barrier *p_barrier, unsigned int count );
+
+/** !
+ * Create a barrier with a completion function. The last thread to
+ * arrive in each phase runs the completion function before any
+ * thread is released.
+ * 
+ * @param p_barrier              result
+ * @param count                  the quantity of threads that must wait at the barrier
+ * @param pfn_barrier_completion the completion function, or null
+ * @param p_context              the parameter of the completion function
+ * 
+ * @sa barrier_create
+ * @sa barrier_destroy
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int barrier_create_completion ( barrier *p_barrier, unsigned int count, fn_barrier_completion *pfn_barrier_completion, void *p_context );
+
+/** !
+ * Wait at a barrier
+ * 
+ * @param p_barrier the barrier
+ * 
+ * @return SYNC_BARRIER_SERIAL_THREAD for exactly one thread in each phase, 1 for the other threads, 0 on error
+ */
+DLLEXPORT int barrier_wait ( barrier *p_barrier );
+
+/** !
+ * Wait at a barrier, and reduce a value from every thread on the way.
+ * Values combine up the arrival tree, and every thread gets the 
+ * result when the barrier releases. Every thread in a phase must
+ * call barrier_wait_reduce with the same reduction.
+ * 
+ * @param p_barrier          the barrier
+ * @param p_value            the caller's value, and the result on return
+ * @param pfn_barrier_reduce the reduction, for example barrier_reduce_sum
+ * 
+ * @sa barrier_reduce_sum
+ * @sa barrier_reduce_min
+ * @sa barrier_reduce_max
+ * 
+ * @return SYNC_BARRIER_SERIAL_THREAD for exactly one thread in each phase, 1 for the other threads, 0 on error
+ */
+DLLEXPORT int barrier_wait_reduce ( barrier *p_barrier, double *p_value, fn_barrier_reduce *pfn_barrier_reduce );
+
+/** !
+ * Reduce two values to their sum
+ * 
+ * @param a the first value
+ * @param b the second value
+ * 
+ * @return a + b
+ */
+DLLEXPORT double barrier_reduce_sum ( double a, double b );
+
+/** !
+ * Reduce two values to their minimum
+ * 
+ * @param a the first value
+ * @param b the second value
+ * 
+ * @return the lesser of a and b
+ */
+DLLEXPORT double barrier_reduce_min ( double a, double b );
+
+/** !
+ * Reduce two values to their maximum
+ * 
+ * @param a the first value
+ * @param b the second value
+ * 
+ * @return the greater of a and b
+ */
+DLLEXPORT double barrier_reduce_max ( double a, double b );
+
+/** !
+ * Arrive at a barrier without waiting. The caller may do independent
+ * work, then wait for the rest of the phase with barrier_wait_token.
+ * 
+ * @param p_barrier the barrier
+ * @param p_token   return the token of the phase the caller arrived in
+ * 
+ * @sa barrier_wait_token
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int barrier_arrive ( barrier *p_barrier, uint32_t *p_token );
+
+/** !
+ * Wait for the phase that a token came from to end
+ * 
+ * @param p_barrier the barrier
+ * @param token     the token from barrier_arrive
+ * 
+ * @sa barrier_arrive
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int barrier_wait_token ( barrier *p_barrier, uint32_t token );
+
+/** !
+ * Destroy a barrier
+ * 
+ * @param p_barrier the barrier
  * 
  * @sa barrier_create
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int barrier_destroy ( barrier *p_barrier );
+DLLEXPORT int barrier_destroy ( barrier *p_barrier );
+#endif
+
+// Phaser
+#ifdef BUILD_SYNC_WITH_PHASER
+/** !
+ * Create a phaser. A phaser is a barrier whose parties may register
+ * and deregister between phases. A phaser with a parent is a tier. 
+ * Its parties arrive at the tier, and the last of them arrives at 
+ * the parent on their behalf, so hundreds of parties never contend
+ * on one word. A tier registers with its parent while it has parties.
+ * Every tier shares the phase of the root.
+ * 
+ * @param p_phaser result
+ * @param p_parent the parent phaser, or null
+ * @param parties  the initial quantity of parties
+ * 
+ * @sa phaser_destroy
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int phaser_create ( phaser *p_phaser, phaser *p_parent, unsigned int parties );
+
+/** !
+ * Register a party with a phaser. The party takes part in the current
+ * phase. If a tier already arrived in the current phase, the party
+ * waits for the next phase before it registers.
+ * 
+ * @param p_phaser the phaser
+ * 
+ * @sa phaser_arrive_and_deregister
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int phaser_register ( phaser *p_phaser );
+
+/** !
+ * Arrive at a phaser without waiting
+ * 
+ * @param p_phaser the phaser
+ * @param p_token  return the token of the phase the caller arrived in
+ * 
+ * @sa phaser_wait_token
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int phaser_arrive ( phaser *p_phaser, uint32_t *p_token );
+
+/** !
+ * Arrive at a phaser, and deregister the caller's party
+ * 
+ * @param p_phaser the phaser
+ * @param p_token  return the token of the phase the caller arrived in
+ * 
+ * @sa phaser_register
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int phaser_arrive_and_deregister ( phaser *p_phaser, uint32_t *p_token );
+
+/** !
+ * Arrive at a phaser, and wait for the other parties
+ * 
+ * @param p_phaser the phaser
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int phaser_arrive_and_wait ( phaser *p_phaser );
+
+/** !
+ * Wait for the phase that a token came from to end
+ * 
+ * @param p_phaser the phaser
+ * @param token    the token from phaser_arrive
+ * 
+ * @sa phaser_arrive
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int phaser_wait_token ( phaser *p_phaser, uint32_t token );
+
+/** !
+ * Destroy a phaser
+ * 
+ * @param p_phaser the phaser
+ * 
+ * @sa phaser_create
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int phaser_destroy ( phaser *p_phaser );
+#endif
+
+// Latch
+#ifdef BUILD_SYNC_WITH_LATCH
+/** !
+ * Create a latch. A latch is a count that threads wait on until it
+ * reaches zero. The count and a waiters flag share one word, so 
+ * counting down is one atomic subtraction, and the thread that 
+ * reaches zero wakes every waiter with one futex call.
+ * 
+ * @param p_latch result
+ * @param count   the initial count
+ * 
+ * @sa latch_destroy
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int latch_create ( latch *p_latch, unsigned int count );
+
+/** !
+ * Add to the count of a latch. Don't add to a latch that waiters
+ * are waiting on at zero.
+ * 
+ * @param p_latch the latch
+ * @param n       the quantity to add
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int latch_add ( latch *p_latch, unsigned int n );
+
+/** !
+ * Wake the waiters of a latch that reached zero. Don't call this directly.
+ * 
+ * @param p_latch the latch
+ * @param count   the count before the caller counted down
+ * @param n       the quantity the caller counted down
+ * 
+ * @sa latch_count_down
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int latch_count_down_slow ( latch *p_latch, uint32_t count, unsigned int n );
+
+/** !
+ * Count down a latch. Counting down past zero is undefined behavior;
+ * the count wraps before the mistake can be reported.
+ * 
+ * @param p_latch the latch
+ * @param n       the quantity to subtract
+ * 
+ * @sa latch_wait
+ * 
+ * @return 1 on success, 0 on error
+ */
+static inline int latch_count_down ( latch *p_latch, unsigned int n )
+{
+
+    // Initialized data
+    uint32_t count = __atomic_fetch_sub(&p_latch->_count, n, __ATOMIC_RELEASE);
+
+    // Fast path. The count is still above zero
+    if ( ( count & SYNC_LATCH_COUNT ) > n ) return 1;
+
+    // Slow path
+    return latch_count_down_slow(p_latch, count, n);
+}
+
+/** !
+ * Wait for the count of a latch to reach zero
+ * 
+ * @param p_latch the latch
+ * 
+ * @sa latch_count_down
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int latch_wait ( latch *p_latch );
+
+/** !
+ * Destroy a latch
+ * 
+ * @param p_latch the latch
+ * 
+ * @sa latch_create
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int latch_destroy ( latch *p_latch );
+#endif
+
+// Once
+#ifdef BUILD_SYNC_WITH_ONCE
+/** !
+ * Run an initializer for the first caller. Don't call this directly.
+ * 
+ * @param p_once_flag   the once flag
+ * @param pfn_sync_once the initializer
+ * @param p_parameter   the parameter of the initializer
+ * 
+ * @sa sync_once
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int sync_once_slow ( once_flag *p_once_flag, fn_sync_once *pfn_sync_once, void *p_parameter );
+
+/** !
+ * Run an initializer exactly once. The first caller runs the 
+ * initializer, and concurrent callers sleep on the once flag until 
+ * it returns. After that, every call is one acquire load. A zeroed
+ * once flag, or SYNC_ONCE_INIT, has not run. The initializer must 
+ * not call sync_once on its own once flag.
+ * 
+ * @param p_once_flag   the once flag
+ * @param pfn_sync_once the initializer
+ * @param p_parameter   the parameter of the initializer
+ * 
+ * @return 1 on success, 0 on error
+ */
+static inline int sync_once ( once_flag *p_once_flag, fn_sync_once *pfn_sync_once, void *p_parameter )
+{
+
+    // Fast path. The initializer already ran
+    if ( __atomic_load_n(&p_once_flag->_state, __ATOMIC_ACQUIRE) == SYNC_ONCE_DONE ) return 1;
+
+    // Slow path
+    return sync_once_slow(p_once_flag, pfn_sync_once, p_parameter);
+}
+#endif
+
+// Eventcount
+#ifdef BUILD_SYNC_WITH_EVENTCOUNT
+
+/** !
+ * Create an eventcount. An eventcount lets lock-free structures 
+ * put consumers to sleep without a mutex. A consumer prepares to 
+ * wait, rechecks the structure, then waits or cancels. Producers 
+ * notify after they publish, which costs a fence and a load when 
+ * nobody is waiting.
+ * 
+ * @param p_eventcount result
+ * 
+ * @sa ec_destroy
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int ec_create ( eventcount *p_eventcount );
+
+/** !
+ * Prepare to wait on an eventcount
+ * 
+ * @param p_eventcount the eventcount
+ * 
+ * @sa ec_wait
+ * @sa ec_cancel_wait
+ * 
+ * @return the key to pass to ec_wait
+ */
+DLLEXPORT uint32_t ec_prepare_wait ( eventcount *p_eventcount );
+
+/** !
+ * Cancel a prepared wait, because the condition became true
+ * 
+ * @param p_eventcount the eventcount
+ * 
+ * @sa ec_prepare_wait
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int ec_cancel_wait ( eventcount *p_eventcount );
+
+/** !
+ * Wait for a notify after a prepared wait. Returns immediately if
+ * a notify happened since ec_prepare_wait.
+ * 
+ * @param p_eventcount the eventcount
+ * @param key          the return value of ec_prepare_wait
+ * 
+ * @sa ec_prepare_wait
+ * @sa ec_notify
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int ec_wait ( eventcount *p_eventcount, uint32_t key );
+
+/** !
+ * Wake sleeping waiters. Don't call this directly.
+ * 
+ * @param p_eventcount the eventcount
+ * @param count        the maximum quantity of waiters to wake
+ * 
+ * @sa ec_notify
+ * @sa ec_notify_all
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int ec_notify_slow ( eventcount *p_eventcount, int count );
+
+/** !
+ * Wake one waiter
+ * 
+ * @param p_eventcount the eventcount
+ * 
+ * @sa ec_notify_all
+ * 
+ * @return 1 on success, 0 on error
+ */
+static inline int ec_notify ( eventcount *p_eventcount )
+{
+
+    // Order the caller's writes before the check for waiters
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    // Fast path. Nobody is waiting
+    if ( ( __atomic_load_n(&p_eventcount->_state, __ATOMIC_RELAXED) & UINT32_MAX ) == 0 ) return 1;
+
+    // Slow path
+    return ec_notify_slow(p_eventcount, 1);
+}
+
+/** !
+ * Wake every waiter
+ * 
+ * @param p_eventcount the eventcount
+ * 
+ * @sa ec_notify
+ * 
+ * @return 1 on success, 0 on error
+ */
+static inline int ec_notify_all ( eventcount *p_eventcount )
+{
+
+    // Order the caller's writes before the check for waiters
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    // Fast path. Nobody is waiting
+    if ( ( __atomic_load_n(&p_eventcount->_state, __ATOMIC_RELAXED) & UINT32_MAX ) == 0 ) return 1;
+
+    // Slow path
+    return ec_notify_slow(p_eventcount, INT32_MAX);
+}
+
+/** !
+ * Destroy an eventcount
+ * 
+ * @param p_eventcount the eventcount
+ * 
+ * @sa ec_create
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int ec_destroy ( eventcount *p_eventcount );
+#endif
+
+// Pool
+#ifdef BUILD_SYNC_WITH_POOL
+/** !
+ * Create a thread pool with one worker per processor, or a 
+ * quantity of workers. Each worker owns a work stealing deque.
+ * Tasks submitted by a worker go onto its own deque. Other tasks 
+ * go onto a shared queue. An idle worker steals from random 
+ * victims, trying its own NUMA node first, then parks on an 
+ * eventcount.
+ * 
+ * @param pp_sync_pool result
+ * @param workers      the quantity of workers, or 0 for one per processor
+ * 
+ * @sa sync_pool_create_affinity
+ * @sa sync_pool_destroy
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int sync_pool_create ( sync_pool **pp_sync_pool, size_t workers );
+
+/** !
+ * Create a thread pool, and pin its workers to processors. Compact
+ * affinity fills each NUMA node before the next. Scatter affinity
+ * deals workers across the nodes in turn.
+ * 
+ * @param pp_sync_pool result
+ * @param workers      the quantity of workers, or 0 for one per processor
+ * @param affinity     how to pin workers to processors
+ * 
+ * @sa sync_pool_create
+ * @sa sync_pool_destroy
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int sync_pool_create_affinity ( sync_pool **pp_sync_pool, size_t workers, sync_pool_affinity affinity );
+
+/** !
+ * Submit a task to a thread pool
+ * 
+ * @param p_sync_pool        the thread pool
+ * @param pfn_sync_pool_task the task
+ * @param p_parameter        the parameter of the task
+ * 
+ * @sa sync_pool_wait
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int sync_pool_submit ( sync_pool *p_sync_pool, fn_sync_pool_task *pfn_sync_pool_task, void *p_parameter );
+
+/** !
+ * Wait for every submitted task to finish, including tasks that 
+ * tasks submit. Don't call this from a task.
+ * 
+ * @param p_sync_pool the thread pool
+ * 
+ * @sa sync_pool_submit
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int sync_pool_wait ( sync_pool *p_sync_pool );
+
+/** !
+ * Wait for every submitted task to finish, then stop the workers, 
+ * and destroy a thread pool
+ * 
+ * @param pp_sync_pool pointer to the thread pool
+ * 
+ * @sa sync_pool_create
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int sync_pool_destroy ( sync_pool **pp_sync_pool );
+#endif
+
+// Trace
+#ifdef BUILD_SYNC_WITH_TRACE
+/** !
+ * Record an event in the trace ring of the calling thread. Each
+ * thread has a fixed size ring; the oldest records are overwritten.
+ * A thread's ring is released when the thread exits, and reused by
+ * the next thread that records an event. Unknown events are ignored.
+ * 
+ * @param event    the event
+ * @param p_object the address of the object the event happened to
+ * 
+ * @sa sync_trace_dump
+ * 
+ * @return void
+ */
+DLLEXPORT void sync_trace_record ( sync_trace_event event, const void *p_object );
+
+/** !
+ * Write the trace rings of every thread as Chrome trace JSON. Open
+ * the output with chrome://tracing or ui.perfetto.dev. Records that
+ * are written during the dump may be torn.
+ * 
+ * @param p_f the file to write to
+ * 
+ * @sa sync_trace_record
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int sync_trace_dump ( FILE *p_f );
+#endif
+
+// Stats
+#ifdef BUILD_SYNC_WITH_STATS
+#if defined(BUILD_SYNC_WITH_MUTEX) && !defined(_WIN64)
+/** !
+ * Get the contention statistics of a mutex.
+ * Times are differences of timestamps.
+ * 
+ * @param p_mutex the mutex
+ * @param p_stats return
+ * 
+ * @sa timer_seconds_divisor
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int mutex_stats_get ( const mutex *p_mutex, sync_stats *p_stats );
+#endif
+
+#if defined(BUILD_SYNC_WITH_SPINLOCK) && !defined(_WIN64)
+/** !
+ * Get the contention statistics of a spinlock.
+ * Times are differences of timestamps.
+ * 
+ * @param p_spinlock the spinlock
+ * @param p_stats    return
+ * 
+ * @sa timer_seconds_divisor
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int spinlock_stats_get ( const spinlock *p_spinlock, sync_stats *p_stats );
+#endif
+
+#ifdef BUILD_SYNC_WITH_RW_LOCK
+/** !
+ * Get the contention statistics of a rwlock.
+ * Times are differences of timestamps. Hold times are only recorded
+ * for writers.
+ * 
+ * @param p_rwlock the rwlock
+ * @param p_stats  return
+ * 
+ * @sa timer_seconds_divisor
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int rwlock_stats_get ( const rwlock *p_rwlock, sync_stats *p_stats );
+#endif
+
+#ifdef BUILD_SYNC_WITH_SEMAPHORE
+/** !
+ * Get the contention statistics of a semaphore.
+ * Times are differences of timestamps. Hold times are not recorded.
+ * 
+ * @param p_semaphore the semaphore
+ * @param p_stats     return
+ * 
+ * @sa timer_seconds_divisor
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int semaphore_stats_get ( const semaphore *p_semaphore, sync_stats *p_stats );
+#endif
 #endif
 
 // Cleanup
@@ -20,19 +20,230 @@
 
 // Preprocessor definitions
 #define NTH_FIBONACCI_NUMBER 1000000000
+#define BARRIER_EXAMPLE_THREADS 5
+#define BARRIER_EXAMPLE_PHASES 1000
+#define RW_LOCK_EXAMPLE_READERS 3
+#define RW_LOCK_EXAMPLE_WRITERS 2
+#define RW_LOCK_EXAMPLE_UPGRADERS 2
+#define RW_LOCK_EXAMPLE_ITERATIONS 10000
+#define SEMAPHORE_EXAMPLE_THREADS 6
+#define SEMAPHORE_EXAMPLE_UNITS 3
+#define SEMAPHORE_EXAMPLE_ITERATIONS 10000
+#define MONITOR_EXAMPLE_PRODUCERS 2
+#define MONITOR_EXAMPLE_CONSUMERS 2
+#define MONITOR_EXAMPLE_ITEMS 10000
+#define MONITOR_EXAMPLE_CAPACITY 4
+#define FAST_MUTEX_EXAMPLE_THREADS 4
+#define FAST_MUTEX_EXAMPLE_ITERATIONS 100000
+#define ADAPTIVE_MUTEX_EXAMPLE_THREADS 4
+#define ADAPTIVE_MUTEX_EXAMPLE_ITERATIONS 100000
+#define MCS_SPINLOCK_EXAMPLE_THREADS 4
+#define MCS_SPINLOCK_EXAMPLE_ITERATIONS 100000
+#define TICKET_SPINLOCK_EXAMPLE_THREADS 4
+#define TICKET_SPINLOCK_EXAMPLE_ITERATIONS 100000
+#define TTAS_SPINLOCK_EXAMPLE_THREADS 4
+#define TTAS_SPINLOCK_EXAMPLE_ITERATIONS 100000
+#define BRLOCK_EXAMPLE_READERS 4
+#define BRLOCK_EXAMPLE_WRITERS 2
+#define BRLOCK_EXAMPLE_READS 100000
+#define BRLOCK_EXAMPLE_WRITES 10000
+#define SEQLOCK_EXAMPLE_READERS 4
+#define SEQLOCK_EXAMPLE_WRITERS 1
+#define SEQLOCK_EXAMPLE_READS 100000
+#define SEQLOCK_EXAMPLE_WRITES 10000
+#define RCU_EXAMPLE_READERS 4
+#define RCU_EXAMPLE_READS 100000
+#define RCU_EXAMPLE_UPDATES 10000
+#define RCU_EXAMPLE_SYNCHRONIZE_PERIOD 16
+#define HAZARD_POINTER_EXAMPLE_READERS 4
+#define HAZARD_POINTER_EXAMPLE_READS 100000
+#define HAZARD_POINTER_EXAMPLE_UPDATES 10000
+#define WSEM_EXAMPLE_THREADS 4
+#define WSEM_EXAMPLE_PERMITS 1024
+#define WSEM_EXAMPLE_ITERATIONS 10000
+#define FAST_CONDITION_VARIABLE_EXAMPLE_THREADS 4
+#define FAST_CONDITION_VARIABLE_EXAMPLE_ROUNDS 1000
+#define EVENTCOUNT_EXAMPLE_PRODUCERS 2
+#define EVENTCOUNT_EXAMPLE_CONSUMERS 2
+#define EVENTCOUNT_EXAMPLE_ITEMS 10000
+#define PHASER_EXAMPLE_TIERS 3
+#define PHASER_EXAMPLE_PARTIES 6
+#define PHASER_EXAMPLE_TRANSIENTS 3
+#define PHASER_EXAMPLE_PHASES 1000
+#define PHASER_EXAMPLE_STAY 3
+#define LATCH_EXAMPLE_THREADS 8
+#define LATCH_EXAMPLE_ITERATIONS 100000
+#define ONCE_EXAMPLE_THREADS 8
+#define ONCE_EXAMPLE_VALUE 42
+#define POOL_EXAMPLE_DEPTH 14
+#define POOL_EXAMPLE_TASKS ( ( (size_t) 2 << POOL_EXAMPLE_DEPTH ) - 1 )
 
 // Enumeration definitions
 enum sync_examples_e
 {
-    SYNC_TIMER_EXAMPLE              = 0,
-    SYNC_MUTEX_EXAMPLE              = 1,
-    SYNC_SPINLOCK_EXAMPLE           = 2,
-    SYNC_RW_LOCK_EXAMPLE            = 3,
-    SYNC_SEMAPHORE_EXAMPLE          = 4,
-    SYNC_CONDITION_VARIABLE_EXAMPLE = 5,
-    SYNC_MONITOR_EXAMPLE            = 6,
-    SYNC_BARRIER_EXAMPLE            = 7,
-    SYNC_EXAMPLE_QUANTITY           = 8
+    SYNC_TIMER_EXAMPLE                   = 0,
+    SYNC_MUTEX_EXAMPLE                   = 1,
+    SYNC_SPINLOCK_EXAMPLE                = 2,
+    SYNC_RW_LOCK_EXAMPLE                 = 3,
+    SYNC_SEMAPHORE_EXAMPLE               = 4,
+    SYNC_CONDITION_VARIABLE_EXAMPLE      = 5,
+    SYNC_MONITOR_EXAMPLE                 = 6,
+    SYNC_BARRIER_EXAMPLE                 = 7,
+    SYNC_FAST_MUTEX_EXAMPLE              = 8,
+    SYNC_ADAPTIVE_MUTEX_EXAMPLE          = 9,
+    SYNC_MCS_SPINLOCK_EXAMPLE            = 10,
+    SYNC_TICKET_SPINLOCK_EXAMPLE         = 11,
+    SYNC_TTAS_SPINLOCK_EXAMPLE           = 12,
+    SYNC_BRLOCK_EXAMPLE                  = 13,
+    SYNC_SEQLOCK_EXAMPLE                 = 14,
+    SYNC_RCU_EXAMPLE                     = 15,
+    SYNC_HAZARD_POINTER_EXAMPLE          = 16,
+    SYNC_WEIGHTED_SEMAPHORE_EXAMPLE      = 17,
+    SYNC_FAST_CONDITION_VARIABLE_EXAMPLE = 18,
+    SYNC_EVENTCOUNT_EXAMPLE              = 19,
+    SYNC_PHASER_EXAMPLE                  = 20,
+    SYNC_LATCH_EXAMPLE                   = 21,
+    SYNC_ONCE_EXAMPLE                    = 22,
+    SYNC_POOL_EXAMPLE                    = 23,
+    SYNC_EXAMPLE_QUANTITY                = 24
+};
+
+// Structure definitions
+struct read_write_lock_example_s
+{
+    rwlock lock;
+    size_t readers, writers, upgraders,
+           a, b, overlaps;
+};
+
+struct semaphore_example_s
+{
+    semaphore semaphore;
+    size_t    started, in_use, overused;
+};
+
+struct monitor_example_s
+{
+    monitor monitor;
+    size_t  not_full, not_empty,
+            items[MONITOR_EXAMPLE_CAPACITY], head, tail, count, sum;
+};
+
+struct fast_mutex_example_s
+{
+    fast_mutex lock;
+    size_t     count;
+};
+
+struct adaptive_mutex_example_s
+{
+    adaptive_mutex lock;
+    size_t         count;
+};
+
+struct mcs_spinlock_example_s
+{
+    mcs_spinlock lock;
+    size_t       count;
+};
+
+struct ticket_spinlock_example_s
+{
+    ticket_spinlock lock;
+    size_t          count;
+};
+
+struct ttas_spinlock_example_s
+{
+    ttas_spinlock lock;
+    size_t        count;
+};
+
+struct brlock_example_s
+{
+    brlock lock;
+    size_t a, b;
+};
+
+struct seqlock_example_s
+{
+    seqlock lock;
+    size_t  a, b;
+};
+
+struct rcu_example_node_s
+{
+    size_t                a, b;
+    struct rcu_example_s *p_example;
+};
+
+struct rcu_example_s
+{
+    struct rcu_example_node_s *p_node;
+    size_t                     reclaimed;
+};
+
+struct hazard_pointer_example_node_s
+{
+    size_t                           a, b;
+    struct hazard_pointer_example_s *p_example;
+};
+
+struct hazard_pointer_example_s
+{
+    struct hazard_pointer_example_node_s *p_node;
+    size_t                                reclaimed;
+};
+
+struct weighted_semaphore_example_s
+{
+    wsem   wsem;
+    size_t started, in_use, overused;
+};
+
+struct fast_condition_variable_example_s
+{
+    fast_mutex              mutex;
+    fast_condition_variable condition;
+    size_t                  arrived, round;
+};
+
+struct eventcount_example_s
+{
+    eventcount eventcount;
+    size_t     items, consumed;
+};
+
+struct phaser_example_s
+{
+    phaser root, tiers[PHASER_EXAMPLE_TIERS];
+    size_t progress[PHASER_EXAMPLE_PARTIES],
+           started, finished, joined, early;
+};
+
+struct latch_example_s
+{
+    latch  start, done;
+    size_t count;
+};
+
+struct once_example_s
+{
+    once_flag flag;
+    size_t    runs, value, seen;
+};
+
+struct pool_example_s
+{
+    sync_pool                  *p_pool;
+    struct pool_example_task_s *p_tasks;
+    size_t                      count, errors;
+};
+
+struct pool_example_task_s
+{
+    struct pool_example_s *p_example;
+    size_t                 index;
 };
 
 // Forward declarations
@@ -96,6 +307,49 @@ int sync_spinlock_example ( int argc, const char *argv[] );
  */
 int sync_read_write_lock_example ( int argc, const char *argv[] );
 
+/** !
+ * Read write lock example reader. Check the counters under a read
+ * lock, and count any overlap with a writer
+ * 
+ * @param p_parameter the counters, and their read write lock
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_read_write_lock_example_reader ( LPVOID p_parameter );
+#else
+void *sync_read_write_lock_example_reader ( void *p_parameter );
+#endif
+
+/** !
+ * Read write lock example writer. Add 1 to each counter under a
+ * write lock, and count any overlap with another holder
+ * 
+ * @param p_parameter the counters, and their read write lock
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_read_write_lock_example_writer ( LPVOID p_parameter );
+#else
+void *sync_read_write_lock_example_writer ( void *p_parameter );
+#endif
+
+/** !
+ * Read write lock example upgrader. Take an upgradable read lock,
+ * upgrade it to add 1 to each counter, then downgrade it, and count
+ * any overlap
+ * 
+ * @param p_parameter the counters, and their read write lock
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_read_write_lock_example_upgrader ( LPVOID p_parameter );
+#else
+void *sync_read_write_lock_example_upgrader ( void *p_parameter );
+#endif
+
 /** !
  * Semaphone example program
  * 
@@ -106,6 +360,21 @@ int sync_read_write_lock_example ( int argc, const char *argv[] );
  */
 int sync_semaphore_example ( int argc, const char *argv[] );
 
+/** !
+ * Semaphore example thread. Take units from the semaphore, count
+ * them as in use, and return them, many times. Every other thread 
+ * takes 2 units at a time
+ * 
+ * @param p_parameter the semaphore, and the count of units in use
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_semaphore_example_thread ( LPVOID p_parameter );
+#else
+void *sync_semaphore_example_thread ( void *p_parameter );
+#endif
+
 /** !
  * Condition variable example program
  * 
@@ -126,6 +395,52 @@ int sync_condition_variable_example ( int argc, const char *argv[] );
  */
 int sync_monitor_example ( int argc, const char *argv[] );
 
+/** !
+ * Monitor example producer. Put the numbers 1 .. n into the buffer,
+ * waiting while it is full
+ * 
+ * @param p_parameter the buffer, and its monitor
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_monitor_example_producer ( LPVOID p_parameter );
+#else
+void *sync_monitor_example_producer ( void *p_parameter );
+#endif
+
+/** !
+ * Monitor example consumer. Take numbers out of the buffer, and sum
+ * them, waiting while it is empty
+ * 
+ * @param p_parameter the buffer, and its monitor
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_monitor_example_consumer ( LPVOID p_parameter );
+#else
+void *sync_monitor_example_consumer ( void *p_parameter );
+#endif
+
+/** !
+ * Monitor example predicate. Check if the buffer has room
+ * 
+ * @param p_context the buffer
+ * 
+ * @return true if the buffer is not full, else false
+ */
+bool sync_monitor_example_not_full ( void *p_context );
+
+/** !
+ * Monitor example predicate. Check if the buffer has an item
+ * 
+ * @param p_context the buffer
+ * 
+ * @return true if the buffer is not empty, else false
+ */
+bool sync_monitor_example_not_empty ( void *p_context );
+
 /** !
  * Barrier example program
  * 
@@ -136,258 +451,3705 @@ int sync_monitor_example ( int argc, const char *argv[] );
  */
 int sync_barrier_example ( int argc, const char *argv[] );
 
-// Entry point
-int main ( int argc, const char *argv[] )
-{
-
-    // Supress compiler warnings
-    (void) argc;
-    (void) argv;
+/** !
+ * Barrier example thread. Add 1 to a sum at the barrier, once per 
+ * phase, and check the sum
+ * 
+ * @param p_parameter the barrier
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_barrier_example_thread ( LPVOID p_parameter );
+#else
+void *sync_barrier_example_thread ( void *p_parameter );
+#endif
 
-    // Initialized data
-    bool examples_to_run[SYNC_EXAMPLE_QUANTITY] = { 0 };
+/** !
+ * Fast mutex example program
+ * 
+ * @param argc the argc parameter of the entry point
+ * @param argv the argv parameter of the entry point
+ * 
+ * @return 1 on success, 0 on error
+ */
+int sync_fast_mutex_example ( int argc, const char *argv[] );
 
-    // Parse command line arguments
-    parse_command_line_arguments(argc, argv, examples_to_run);
+/** !
+ * Fast mutex example thread. Add 1 to a counter while holding the
+ * fast mutex, many times
+ * 
+ * @param p_parameter the counter, and its fast mutex
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_fast_mutex_example_thread ( LPVOID p_parameter );
+#else
+void *sync_fast_mutex_example_thread ( void *p_parameter );
+#endif
 
-    // Formatting
-    log_info(
-        "╭──────────────╮\n"\
-        "│ sync example │\n"\
-        "╰──────────────╯\n"\
-        "The sync library provides cross platform synchronization primitives and high-precision timing\n"\
-        "Sync provides %d abstractions. The timer, the mutex, the spinlock, the semaphore, and the monitor.\n\n"\
-        "A timer is used to collect high percision timestsamps.\n"\
-        "A mutex is the most basic synchronization primitive. It provides mutual exclusion to code.\n"\
-        "A spinlock is a type of mutex. It provides mutual exclusion to code.\n"\
-        "A semaphore is an abstraction for controlling access to a resource.\n"\
-        "A monitor is an abstraction for blocking and signaling threads in a critical section.\n\n",
-        SYNC_EXAMPLE_QUANTITY
-    );
+/** !
+ * Adaptive mutex example program
+ * 
+ * @param argc the argc parameter of the entry point
+ * @param argv the argv parameter of the entry point
+ * 
+ * @return 1 on success, 0 on error
+ */
+int sync_adaptive_mutex_example ( int argc, const char *argv[] );
 
-    //////////////////////
-    // Run the examples //
-    //////////////////////
+/** !
+ * Adaptive mutex example thread. Add 1 to a counter while holding the
+ * adaptive mutex, many times
+ * 
+ * @param p_parameter the counter, and its adaptive mutex
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_adaptive_mutex_example_thread ( LPVOID p_parameter );
+#else
+void *sync_adaptive_mutex_example_thread ( void *p_parameter );
+#endif
 
-    // Run the thread example program
-    if ( examples_to_run[SYNC_TIMER_EXAMPLE] )
+/** !
+ * MCS spinlock example program
+ * 
+ * @param argc the argc parameter of the entry point
+ * @param argv the argv parameter of the entry point
+ * 
+ * @return 1 on success, 0 on error
+ */
+int sync_mcs_spinlock_example ( int argc, const char *argv[] );
 
-        // Error check
-        if ( sync_timer_example(argc, argv) == 0 ) goto failed_to_run_timer_example;
-    
-    // Run the mutex example program
-    if ( examples_to_run[SYNC_MUTEX_EXAMPLE] )
+/** !
+ * Mcs spinlock example thread. Add 1 to a counter while holding the
+ * MCS spinlock, many times
+ * 
+ * @param p_parameter the counter, and its MCS spinlock
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_mcs_spinlock_example_thread ( LPVOID p_parameter );
+#else
+void *sync_mcs_spinlock_example_thread ( void *p_parameter );
+#endif
 
-        // Error check
-        if ( sync_mutex_example(argc, argv) == 0 ) goto failed_to_run_mutex_example;
-    
-    // Run the spinlock example program
-    if ( examples_to_run[SYNC_SPINLOCK_EXAMPLE] )
+/** !
+ * Ticket spinlock example program
+ * 
+ * @param argc the argc parameter of the entry point
+ * @param argv the argv parameter of the entry point
+ * 
+ * @return 1 on success, 0 on error
+ */
+int sync_ticket_spinlock_example ( int argc, const char *argv[] );
 
-        // Error check
-        if ( sync_spinlock_example(argc, argv) == 0 ) goto failed_to_run_spinlock_example;
+/** !
+ * Ticket spinlock example thread. Add 1 to a counter while holding the
+ * ticket spinlock, many times
+ * 
+ * @param p_parameter the counter, and its ticket spinlock
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_ticket_spinlock_example_thread ( LPVOID p_parameter );
+#else
+void *sync_ticket_spinlock_example_thread ( void *p_parameter );
+#endif
 
-    // Run the read write lock example program
-    if ( examples_to_run[SYNC_RW_LOCK_EXAMPLE] )
+/** !
+ * TTAS spinlock example program
+ * 
+ * @param argc the argc parameter of the entry point
+ * @param argv the argv parameter of the entry point
+ * 
+ * @return 1 on success, 0 on error
+ */
+int sync_ttas_spinlock_example ( int argc, const char *argv[] );
 
-        // Error check
-        if ( sync_read_write_lock_example(argc, argv) == 0 ) goto failed_to_run_read_write_lock_example;
-    
-    // Run the semaphore example program
-    if ( examples_to_run[SYNC_SEMAPHORE_EXAMPLE] )
+/** !
+ * Ttas spinlock example thread. Add 1 to a counter while holding the
+ * TTAS spinlock, many times
+ * 
+ * @param p_parameter the counter, and its TTAS spinlock
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_ttas_spinlock_example_thread ( LPVOID p_parameter );
+#else
+void *sync_ttas_spinlock_example_thread ( void *p_parameter );
+#endif
 
-        // Error check
-        if ( sync_semaphore_example(argc, argv) == 0 ) goto failed_to_run_semaphore_example;
-    
-    // Run the condition variable example program
-    if ( examples_to_run[SYNC_CONDITION_VARIABLE_EXAMPLE] )
+/** !
+ * Big reader lock example program
+ * 
+ * @param argc the argc parameter of the entry point
+ * @param argv the argv parameter of the entry point
+ * 
+ * @return 1 on success, 0 on error
+ */
+int sync_brlock_example ( int argc, const char *argv[] );
 
-        // Error check
-        if ( sync_condition_variable_example(argc, argv) == 0 ) goto failed_to_run_condition_variable_example;
-    
-    // Run the monitor example program
-    if ( examples_to_run[SYNC_MONITOR_EXAMPLE] )
+/** !
+ * Big reader lock example reader. Read the counters many times, and check
+ * that they are equal
+ * 
+ * @param p_parameter the counters, and their big reader lock
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_brlock_example_reader ( LPVOID p_parameter );
+#else
+void *sync_brlock_example_reader ( void *p_parameter );
+#endif
 
-        // Error check
-        if ( sync_monitor_example(argc, argv) == 0 ) goto failed_to_run_monitor_example;
-    
-    // Run the barrier example program
-    if ( examples_to_run[SYNC_BARRIER_EXAMPLE] )
+/** !
+ * Big reader lock example writer. Add 1 to each counter, many times
+ * 
+ * @param p_parameter the counters, and their big reader lock
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_brlock_example_writer ( LPVOID p_parameter );
+#else
+void *sync_brlock_example_writer ( void *p_parameter );
+#endif
 
-        // Error check
-        if ( sync_barrier_example(argc, argv) == 0 ) goto failed_to_run_barrier_example;
-    
-    // Success
-    return EXIT_SUCCESS;
+/** !
+ * Seqlock example program
+ * 
+ * @param argc the argc parameter of the entry point
+ * @param argv the argv parameter of the entry point
+ * 
+ * @return 1 on success, 0 on error
+ */
+int sync_seqlock_example ( int argc, const char *argv[] );
+
+/** !
+ * Seqlock example reader. Read the counters many times, and check
+ * that they are equal
+ * 
+ * @param p_parameter the counters, and their seqlock
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_seqlock_example_reader ( LPVOID p_parameter );
+#else
+void *sync_seqlock_example_reader ( void *p_parameter );
+#endif
+
+/** !
+ * Seqlock example writer. Add 1 to each counter, many times
+ * 
+ * @param p_parameter the counters, and their seqlock
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_seqlock_example_writer ( LPVOID p_parameter );
+#else
+void *sync_seqlock_example_writer ( void *p_parameter );
+#endif
+
+/** !
+ * Read copy update example program
+ * 
+ * @param argc the argc parameter of the entry point
+ * @param argv the argv parameter of the entry point
+ * 
+ * @return 1 on success, 0 on error
+ */
+int sync_rcu_example ( int argc, const char *argv[] );
+
+/** !
+ * Read copy update example reader. Read the shared node many times, and
+ * check that it is whole
+ * 
+ * @param p_parameter the shared node
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_rcu_example_reader ( LPVOID p_parameter );
+#else
+void *sync_rcu_example_reader ( void *p_parameter );
+#endif
+
+/** !
+ * Read copy update example updater. Replace the shared node many times,
+ * and retire each node it replaces
+ * 
+ * @param p_parameter the shared node
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_rcu_example_updater ( LPVOID p_parameter );
+#else
+void *sync_rcu_example_updater ( void *p_parameter );
+#endif
+
+/** !
+ * Poison a retired node, and free it
+ * 
+ * @param p_value the node
+ * 
+ * @return void
+ */
+void sync_rcu_example_reclaim ( void *p_value );
+
+/** !
+ * Hazard pointer example program
+ * 
+ * @param argc the argc parameter of the entry point
+ * @param argv the argv parameter of the entry point
+ * 
+ * @return 1 on success, 0 on error
+ */
+int sync_hazard_pointer_example ( int argc, const char *argv[] );
+
+/** !
+ * Hazard pointer example reader. Read the shared node many times, and
+ * check that it is whole
+ * 
+ * @param p_parameter the shared node
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_hazard_pointer_example_reader ( LPVOID p_parameter );
+#else
+void *sync_hazard_pointer_example_reader ( void *p_parameter );
+#endif
+
+/** !
+ * Hazard pointer example updater. Replace the shared node many times,
+ * and retire each node it replaces
+ * 
+ * @param p_parameter the shared node
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_hazard_pointer_example_updater ( LPVOID p_parameter );
+#else
+void *sync_hazard_pointer_example_updater ( void *p_parameter );
+#endif
+
+/** !
+ * Poison a retired node, and free it
+ * 
+ * @param p_value the node
+ * 
+ * @return void
+ */
+void sync_hazard_pointer_example_reclaim ( void *p_value );
+
+/** !
+ * Weighted semaphore example program
+ * 
+ * @param argc the argc parameter of the entry point
+ * @param argv the argv parameter of the entry point
+ * 
+ * @return 1 on success, 0 on error
+ */
+int sync_weighted_semaphore_example ( int argc, const char *argv[] );
+
+/** !
+ * Weighted semaphore example thread. Acquire permits, count them
+ * as in use, and release them, many times. Each thread acquires a
+ * different quantity of permits
+ * 
+ * @param p_parameter the weighted semaphore, and the count of permits in use
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_weighted_semaphore_example_thread ( LPVOID p_parameter );
+#else
+void *sync_weighted_semaphore_example_thread ( void *p_parameter );
+#endif
+
+/** !
+ * Fast condition variable example program
+ * 
+ * @param argc the argc parameter of the entry point
+ * @param argv the argv parameter of the entry point
+ * 
+ * @return 1 on success, 0 on error
+ */
+int sync_fast_condition_variable_example ( int argc, const char *argv[] );
+
+/** !
+ * Fast condition variable example thread. Meet the other threads
+ * once per round. The last thread to arrive starts the next round,
+ * and wakes the others with a broadcast
+ * 
+ * @param p_parameter the round, and its fast mutex and fast condition variable
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_fast_condition_variable_example_thread ( LPVOID p_parameter );
+#else
+void *sync_fast_condition_variable_example_thread ( void *p_parameter );
+#endif
+
+/** !
+ * Eventcount example program
+ * 
+ * @param argc the argc parameter of the entry point
+ * @param argv the argv parameter of the entry point
+ * 
+ * @return 1 on success, 0 on error
+ */
+int sync_eventcount_example ( int argc, const char *argv[] );
+
+/** !
+ * Eventcount example producer. Add items without a lock, and notify
+ * the eventcount after each one
+ * 
+ * @param p_parameter the item count, and its eventcount
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_eventcount_example_producer ( LPVOID p_parameter );
+#else
+void *sync_eventcount_example_producer ( void *p_parameter );
+#endif
+
+/** !
+ * Eventcount example consumer. Take items without a lock, and wait
+ * on the eventcount when there are none
+ * 
+ * @param p_parameter the item count, and its eventcount
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_eventcount_example_consumer ( LPVOID p_parameter );
+#else
+void *sync_eventcount_example_consumer ( void *p_parameter );
+#endif
+
+/** !
+ * Take an item, if there is one
+ * 
+ * @param p_example the item count
+ * 
+ * @return true if an item was taken, else false
+ */
+bool sync_eventcount_example_take ( struct eventcount_example_s *p_example );
+
+/** !
+ * Phaser example program
+ * 
+ * @param argc the argc parameter of the entry point
+ * @param argv the argv parameter of the entry point
+ * 
+ * @return 1 on success, 0 on error
+ */
+int sync_phaser_example ( int argc, const char *argv[] );
+
+/** !
+ * Phaser example party. Arrive at a tier once per phase, and check
+ * that no party is behind when the phase ends
+ * 
+ * @param p_parameter the phasers, and the progress of each party
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_phaser_example_party ( LPVOID p_parameter );
+#else
+void *sync_phaser_example_party ( void *p_parameter );
+#endif
+
+/** !
+ * Phaser example transient party. Join a tier for a few phases, 
+ * then leave, until every other party has finished
+ * 
+ * @param p_parameter the phasers, and the progress of each party
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_phaser_example_transient ( LPVOID p_parameter );
+#else
+void *sync_phaser_example_transient ( void *p_parameter );
+#endif
+
+/** !
+ * Latch example program
+ * 
+ * @param argc the argc parameter of the entry point
+ * @param argv the argv parameter of the entry point
+ * 
+ * @return 1 on success, 0 on error
+ */
+int sync_latch_example ( int argc, const char *argv[] );
+
+/** !
+ * Latch example thread. Wait for the start latch, add to a counter
+ * many times, then count down the done latch
+ * 
+ * @param p_parameter the latches, and the counter
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_latch_example_thread ( LPVOID p_parameter );
+#else
+void *sync_latch_example_thread ( void *p_parameter );
+#endif
+
+/** !
+ * Once example program
+ * 
+ * @param argc the argc parameter of the entry point
+ * @param argv the argv parameter of the entry point
+ * 
+ * @return 1 on success, 0 on error
+ */
+int sync_once_example ( int argc, const char *argv[] );
+
+/** !
+ * Once example thread. Initialize the value through the once flag,
+ * and check that the value is initialized
+ * 
+ * @param p_parameter the once flag, and the value
+ * 
+ * @return 0 on success, 1 on error
+ */
+#ifdef _WIN64
+DWORD WINAPI sync_once_example_thread ( LPVOID p_parameter );
+#else
+void *sync_once_example_thread ( void *p_parameter );
+#endif
+
+/** !
+ * Once example initializer. Count the run, and set the value
+ * 
+ * @param p_parameter the once flag, and the value
+ * 
+ * @return void
+ */
+void sync_once_example_init ( void *p_parameter );
+
+/** !
+ * Pool example program
+ * 
+ * @param argc the argc parameter of the entry point
+ * @param argv the argv parameter of the entry point
+ * 
+ * @return 1 on success, 0 on error
+ */
+int sync_pool_example ( int argc, const char *argv[] );
+
+/** !
+ * Pool example task. Count the task, and submit its two children,
+ * until the tree is POOL_EXAMPLE_DEPTH levels deep
+ * 
+ * @param p_parameter the task, and its index in the tree
+ * 
+ * @return void
+ */
+void sync_pool_example_task ( void *p_parameter );
+
+// Entry point
+int main ( int argc, const char *argv[] )
+{
+
+    // Supress compiler warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    bool examples_to_run[SYNC_EXAMPLE_QUANTITY] = { 0 };
+
+    // Parse command line arguments
+    parse_command_line_arguments(argc, argv, examples_to_run);
+
+    // Formatting
+    log_info(
+        "╭──────────────╮\n"\
+        "│ sync example │\n"\
+        "╰──────────────╯\n"\
+        "The sync library provides cross platform synchronization primitives and high-precision timing\n"\
+        "Sync provides %d abstractions. The timer, the mutex, the spinlock, the semaphore, and the monitor.\n\n"\
+        "A timer is used to collect high percision timestsamps.\n"\
+        "A mutex is the most basic synchronization primitive. It provides mutual exclusion to code.\n"\
+        "A spinlock is a type of mutex. It provides mutual exclusion to code.\n"\
+        "A semaphore is an abstraction for controlling access to a resource.\n"\
+        "A monitor is an abstraction for blocking and signaling threads in a critical section.\n\n",
+        SYNC_EXAMPLE_QUANTITY
+    );
+
+    //////////////////////
+    // Run the examples //
+    //////////////////////
+
+    // Run the thread example program
+    if ( examples_to_run[SYNC_TIMER_EXAMPLE] )
+
+        // Error check
+        if ( sync_timer_example(argc, argv) == 0 ) goto failed_to_run_timer_example;
+    
+    // Run the mutex example program
+    if ( examples_to_run[SYNC_MUTEX_EXAMPLE] )
+
+        // Error check
+        if ( sync_mutex_example(argc, argv) == 0 ) goto failed_to_run_mutex_example;
+    
+    // Run the spinlock example program
+    if ( examples_to_run[SYNC_SPINLOCK_EXAMPLE] )
+
+        // Error check
+        if ( sync_spinlock_example(argc, argv) == 0 ) goto failed_to_run_spinlock_example;
+
+    // Run the read write lock example program
+    if ( examples_to_run[SYNC_RW_LOCK_EXAMPLE] )
+
+        // Error check
+        if ( sync_read_write_lock_example(argc, argv) == 0 ) goto failed_to_run_read_write_lock_example;
+    
+    // Run the semaphore example program
+    if ( examples_to_run[SYNC_SEMAPHORE_EXAMPLE] )
+
+        // Error check
+        if ( sync_semaphore_example(argc, argv) == 0 ) goto failed_to_run_semaphore_example;
+    
+    // Run the condition variable example program
+    if ( examples_to_run[SYNC_CONDITION_VARIABLE_EXAMPLE] )
+
+        // Error check
+        if ( sync_condition_variable_example(argc, argv) == 0 ) goto failed_to_run_condition_variable_example;
+    
+    // Run the monitor example program
+    if ( examples_to_run[SYNC_MONITOR_EXAMPLE] )
+
+        // Error check
+        if ( sync_monitor_example(argc, argv) == 0 ) goto failed_to_run_monitor_example;
+    
+    // Run the barrier example program
+    if ( examples_to_run[SYNC_BARRIER_EXAMPLE] )
+
+        // Error check
+        if ( sync_barrier_example(argc, argv) == 0 ) goto failed_to_run_barrier_example;
+    
+    // Run the fast mutex example program
+    if ( examples_to_run[SYNC_FAST_MUTEX_EXAMPLE] )
+
+        // Error check
+        if ( sync_fast_mutex_example(argc, argv) == 0 ) goto failed_to_run_fast_mutex_example;
+    
+    // Run the adaptive mutex example program
+    if ( examples_to_run[SYNC_ADAPTIVE_MUTEX_EXAMPLE] )
+
+        // Error check
+        if ( sync_adaptive_mutex_example(argc, argv) == 0 ) goto failed_to_run_adaptive_mutex_example;
+    
+    // Run the MCS spinlock example program
+    if ( examples_to_run[SYNC_MCS_SPINLOCK_EXAMPLE] )
+
+        // Error check
+        if ( sync_mcs_spinlock_example(argc, argv) == 0 ) goto failed_to_run_mcs_spinlock_example;
+    
+    // Run the ticket spinlock example program
+    if ( examples_to_run[SYNC_TICKET_SPINLOCK_EXAMPLE] )
+
+        // Error check
+        if ( sync_ticket_spinlock_example(argc, argv) == 0 ) goto failed_to_run_ticket_spinlock_example;
+    
+    // Run the TTAS spinlock example program
+    if ( examples_to_run[SYNC_TTAS_SPINLOCK_EXAMPLE] )
+
+        // Error check
+        if ( sync_ttas_spinlock_example(argc, argv) == 0 ) goto failed_to_run_ttas_spinlock_example;
+    
+    // Run the brlock example program
+    if ( examples_to_run[SYNC_BRLOCK_EXAMPLE] )
+
+        // Error check
+        if ( sync_brlock_example(argc, argv) == 0 ) goto failed_to_run_brlock_example;
+    
+    // Run the seqlock example program
+    if ( examples_to_run[SYNC_SEQLOCK_EXAMPLE] )
+
+        // Error check
+        if ( sync_seqlock_example(argc, argv) == 0 ) goto failed_to_run_seqlock_example;
+    
+    // Run the read copy update example program
+    if ( examples_to_run[SYNC_RCU_EXAMPLE] )
+
+        // Error check
+        if ( sync_rcu_example(argc, argv) == 0 ) goto failed_to_run_rcu_example;
+    
+    // Run the hazard pointer example program
+    if ( examples_to_run[SYNC_HAZARD_POINTER_EXAMPLE] )
+
+        // Error check
+        if ( sync_hazard_pointer_example(argc, argv) == 0 ) goto failed_to_run_hazard_pointer_example;
+    
+    // Run the weighted semaphore example program
+    if ( examples_to_run[SYNC_WEIGHTED_SEMAPHORE_EXAMPLE] )
+
+        // Error check
+        if ( sync_weighted_semaphore_example(argc, argv) == 0 ) goto failed_to_run_weighted_semaphore_example;
+    
+    // Run the fast condition variable example program
+    if ( examples_to_run[SYNC_FAST_CONDITION_VARIABLE_EXAMPLE] )
+
+        // Error check
+        if ( sync_fast_condition_variable_example(argc, argv) == 0 ) goto failed_to_run_fast_condition_variable_example;
+    
+    // Run the eventcount example program
+    if ( examples_to_run[SYNC_EVENTCOUNT_EXAMPLE] )
+
+        // Error check
+        if ( sync_eventcount_example(argc, argv) == 0 ) goto failed_to_run_eventcount_example;
+    
+    // Run the phaser example program
+    if ( examples_to_run[SYNC_PHASER_EXAMPLE] )
+
+        // Error check
+        if ( sync_phaser_example(argc, argv) == 0 ) goto failed_to_run_phaser_example;
+    
+    // Run the latch example program
+    if ( examples_to_run[SYNC_LATCH_EXAMPLE] )
+
+        // Error check
+        if ( sync_latch_example(argc, argv) == 0 ) goto failed_to_run_latch_example;
+    
+    // Run the once example program
+    if ( examples_to_run[SYNC_ONCE_EXAMPLE] )
+
+        // Error check
+        if ( sync_once_example(argc, argv) == 0 ) goto failed_to_run_once_example;
+    
+    // Run the pool example program
+    if ( examples_to_run[SYNC_POOL_EXAMPLE] )
+
+        // Error check
+        if ( sync_pool_example(argc, argv) == 0 ) goto failed_to_run_pool_example;
+    
+    // Success
+    return EXIT_SUCCESS;
+
+    // Error handling
+    {
+        failed_to_run_timer_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run timer example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_mutex_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run mutex example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+            
+        failed_to_run_spinlock_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run spinlock example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+        
+        failed_to_run_read_write_lock_example:
+        
+            // Write an error message to standard out
+            log_error("Error: Failed to run read write lock example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+            
+        failed_to_run_semaphore_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run semaphore example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+        
+        failed_to_run_condition_variable_example:
+        
+            // Write an error message to standard out
+            log_error("Error: Failed to run condition variable example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_monitor_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run monitor example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_barrier_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run barrier example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_fast_mutex_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run fast mutex example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_adaptive_mutex_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run adaptive mutex example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_mcs_spinlock_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run MCS spinlock example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_ticket_spinlock_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run ticket spinlock example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_ttas_spinlock_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run TTAS spinlock example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_brlock_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run brlock example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_seqlock_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run seqlock example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_rcu_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run read copy update example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_hazard_pointer_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run hazard pointer example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_weighted_semaphore_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run weighted semaphore example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_fast_condition_variable_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run fast condition variable example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_eventcount_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run eventcount example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_phaser_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run phaser example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_latch_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run latch example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_once_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run once example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_run_pool_example:
+
+            // Write an error message to standard out
+            log_error("Error: Failed to run pool example!\n");
+
+            // Error
+            return EXIT_FAILURE;
+    }
+}
+
+void print_usage ( const char *argv0 )
+{
+
+    // Argument check
+    if ( argv0 == (void *) 0 ) exit(EXIT_FAILURE);
+
+    // Print a usage message to standard out
+    printf("Usage: %s [timer] [mutex] [spinlock] [read-write] [semaphore] [condition-variable] [monitor] [barrier] [fast-mutex] [adaptive-mutex] [mcs-spinlock] [ticket-spinlock] [ttas-spinlock] [brlock] [seqlock] [rcu] [hazard-pointer] [weighted-semaphore] [fast-condition-variable] [eventcount] [phaser] [latch] [once] [pool]\n", argv0);
+
+    // Done
+    return;
+}
+
+void parse_command_line_arguments ( int argc, const char *argv[], bool *examples_to_run )
+{
+
+    // If no command line arguments are supplied, run all the examples
+    if ( argc == 1 ) goto all_examples;
+
+    // Error check
+    if ( argc > SYNC_EXAMPLE_QUANTITY + 1 ) goto invalid_arguments;
+
+    // Iterate through each command line argument
+    for (int i = 1; i < argc; i++)
+    {
+        
+        // Timer example?
+        if ( strcmp(argv[i], "timer") == 0 )
+
+            // Set the timer example flag
+            examples_to_run[SYNC_TIMER_EXAMPLE] = true;
+
+        // Mutex example?
+        else if ( strcmp(argv[i], "mutex") == 0 )
+            
+            // Set the mutex example flag
+            examples_to_run[SYNC_MUTEX_EXAMPLE] = true;
+
+        // Spinlock example?
+        else if ( strcmp(argv[i], "spinlock") == 0 )
+            
+            // Set the spinlock example flag
+            examples_to_run[SYNC_SPINLOCK_EXAMPLE] = true;
+
+        // Read Write Lock example?
+        else if ( strcmp(argv[i], "read-write") == 0 )
+            
+            // Set the read write lock example flag
+            examples_to_run[SYNC_RW_LOCK_EXAMPLE] = true;
+
+        // Semaphore example?
+        else if ( strcmp(argv[i], "semaphore") == 0 )
+
+            // Set the semaphore flag
+            examples_to_run[SYNC_SEMAPHORE_EXAMPLE] = true;
+        
+        // Monitor example?
+        else if ( strcmp(argv[i], "monitor") == 0 )
+
+            // Set the monitor flag
+            examples_to_run[SYNC_MONITOR_EXAMPLE] = true;
+
+        // Barrier example?
+        else if ( strcmp(argv[i], "barrier") == 0 )
+
+            // Set the barrier flag
+            examples_to_run[SYNC_BARRIER_EXAMPLE] = true;
+
+        // Fast mutex example?
+        else if ( strcmp(argv[i], "fast-mutex") == 0 )
+
+            // Set the fast mutex flag
+            examples_to_run[SYNC_FAST_MUTEX_EXAMPLE] = true;
+
+        // Adaptive mutex example?
+        else if ( strcmp(argv[i], "adaptive-mutex") == 0 )
+
+            // Set the adaptive mutex flag
+            examples_to_run[SYNC_ADAPTIVE_MUTEX_EXAMPLE] = true;
+
+        // MCS spinlock example?
+        else if ( strcmp(argv[i], "mcs-spinlock") == 0 )
+
+            // Set the MCS spinlock flag
+            examples_to_run[SYNC_MCS_SPINLOCK_EXAMPLE] = true;
+
+        // Ticket spinlock example?
+        else if ( strcmp(argv[i], "ticket-spinlock") == 0 )
+
+            // Set the ticket spinlock flag
+            examples_to_run[SYNC_TICKET_SPINLOCK_EXAMPLE] = true;
+
+        // TTAS spinlock example?
+        else if ( strcmp(argv[i], "ttas-spinlock") == 0 )
+
+            // Set the TTAS spinlock flag
+            examples_to_run[SYNC_TTAS_SPINLOCK_EXAMPLE] = true;
+
+        // Big reader lock example?
+        else if ( strcmp(argv[i], "brlock") == 0 )
+
+            // Set the brlock flag
+            examples_to_run[SYNC_BRLOCK_EXAMPLE] = true;
+
+        // Seqlock example?
+        else if ( strcmp(argv[i], "seqlock") == 0 )
+
+            // Set the seqlock flag
+            examples_to_run[SYNC_SEQLOCK_EXAMPLE] = true;
+
+        // Read copy update example?
+        else if ( strcmp(argv[i], "rcu") == 0 )
+
+            // Set the read copy update flag
+            examples_to_run[SYNC_RCU_EXAMPLE] = true;
+
+        // Hazard pointer example?
+        else if ( strcmp(argv[i], "hazard-pointer") == 0 )
+
+            // Set the hazard pointer flag
+            examples_to_run[SYNC_HAZARD_POINTER_EXAMPLE] = true;
+
+        // Weighted semaphore example?
+        else if ( strcmp(argv[i], "weighted-semaphore") == 0 )
+
+            // Set the weighted semaphore flag
+            examples_to_run[SYNC_WEIGHTED_SEMAPHORE_EXAMPLE] = true;
+
+        // Fast condition variable example?
+        else if ( strcmp(argv[i], "fast-condition-variable") == 0 )
+
+            // Set the fast condition variable flag
+            examples_to_run[SYNC_FAST_CONDITION_VARIABLE_EXAMPLE] = true;
+
+        // Eventcount example?
+        else if ( strcmp(argv[i], "eventcount") == 0 )
+
+            // Set the eventcount flag
+            examples_to_run[SYNC_EVENTCOUNT_EXAMPLE] = true;
+
+        // Phaser example?
+        else if ( strcmp(argv[i], "phaser") == 0 )
+
+            // Set the phaser flag
+            examples_to_run[SYNC_PHASER_EXAMPLE] = true;
+
+        // Latch example?
+        else if ( strcmp(argv[i], "latch") == 0 )
+
+            // Set the latch flag
+            examples_to_run[SYNC_LATCH_EXAMPLE] = true;
+
+        // Once example?
+        else if ( strcmp(argv[i], "once") == 0 )
+
+            // Set the once flag
+            examples_to_run[SYNC_ONCE_EXAMPLE] = true;
+
+        // Pool example?
+        else if ( strcmp(argv[i], "pool") == 0 )
+
+            // Set the pool flag
+            examples_to_run[SYNC_POOL_EXAMPLE] = true;
+
+        // Default
+        else goto invalid_arguments;
+    }
+    
+    // Success
+    return;
+
+    // Set each example flag
+    all_examples:
+    {
+
+        // For each example ...
+        for (size_t i = 0; i < SYNC_EXAMPLE_QUANTITY; i++)
+        
+            // ... set the example flag
+            examples_to_run[i] = true;
+        
+        // Success
+        return;
+    }
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            invalid_arguments:
+                
+                // Print a usage message to standard out
+                print_usage(argv[0]);
+
+                // Abort
+                exit(EXIT_FAILURE);
+        }
+    }
+}
+
+int sync_timer_example ( int argc, const char *argv[] )
+{
+
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    size_t    c   = 0,
+              d   = 1;
+    double    sec = 0;
+    timestamp t1  = 0, 
+              t2  = 0,
+              td  = 0;
+
+    // Formatting
+    log_info(
+        "╭───────────────╮\n"\
+        "│ timer example │\n"\
+        "╰───────────────╯\n"\
+        "In this example, the timer is initialized. The program samples a timestamp t0,\n"\
+        "computes the 1,000,000,000th fibonacci number, and samples another timestamp t1.\n"\
+        "The difference of the timestamps (t1 - t0) is printed to standard out.\n\n"
+    );
+
+    // Record a timestamp
+    t1 = timer_high_precision();
+
+    // Iteratively calculate fib(NTH_FIBONACCI_NUMBER) 
+    for (size_t i = 0; i < NTH_FIBONACCI_NUMBER; i++)
+    {
+
+        // Initialized data
+        size_t e = c + d;
+
+        // Iteration
+        c = d, d = e;
+    }
+    
+    // Record another timestamp
+    t2 = timer_high_precision();
+
+    // Compute the difference
+    td = t2 - t1;
+
+    // Convert the difference to seconds
+    sec = (double) td / (double) ( timer_seconds_divisor() );
+
+    // Print the time difference in seconds
+    (void)printf("%zu\r[sync] [timer] It took %lf seconds to calculate fib(%d)\n", d, sec, NTH_FIBONACCI_NUMBER);
+
+    // Format
+    putchar('\n');
+
+    // Success
+    return 1;
+}
+
+int sync_mutex_example ( int argc, const char *argv[] )
+{
+
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    mutex m = { 0 };
+
+    // Formatting
+    log_info(
+        "╭───────────────╮\n"\
+        "│ mutex example │\n"\
+        "╰───────────────╯\n"\
+        "In this example, a mutex is created and locked. The program does a pretend\n"\
+        "critical section, then the mutex is unlocked. Finally, the mutex is destroyed\n\n"
+    );
+
+    // Create
+    if ( mutex_create(&m) == 0 ) return EXIT_FAILURE;
+
+    // Lock
+    printf("[WAIT] Locking mutex ... \r");
+    (void) mutex_lock(&m);
+    log_info("[DONE]\n");
+
+    // ... (Pretend) critical section ...
+    printf("This message was printed from a critical section\n");
+
+    // Unlock
+    printf("[WAIT] Unlocking mutex ... \r");
+    (void) mutex_unlock(&m);
+    log_info("[DONE]\n");
+
+    // Destroy
+    (void) mutex_destroy(&m);
+
+    // Format
+    putchar('\n');
+
+    // Success
+    return 1;
+}
+
+int sync_spinlock_example ( int argc, const char *argv[] )
+{
+
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    spinlock sl = { 0 };
+
+    // Formatting
+    log_info(
+        "╭──────────────────╮\n"\
+        "│ spinlock example │\n"\
+        "╰──────────────────╯\n"\
+        "In this example, a spinlock is created and locked. The program does a pretend\n"\
+        "critical section, then the spinlock is unlocked. Finally, the spinlock is destroyed\n\n"
+    );
+
+    // Create
+    if ( spinlock_create(&sl) == 0 ) return EXIT_FAILURE;
+
+    // Lock
+    printf("[WAIT] Locking spinlock ... \r");
+    spinlock_lock(&sl);
+    log_info("[DONE]\n");
+
+    // ... (Pretend) critical section ...
+    printf("This message was printed from a critical section\n");
+
+    // Unlock
+    printf("[WAIT] Unlocking spinlock ... \r");
+    (void) spinlock_unlock(&sl);
+    log_info("[DONE]\n");
+
+    // Destroy
+    (void) spinlock_destroy(&sl);
+
+    // Format
+    putchar('\n');
+
+    // Success
+    return 1;
+}
+
+int sync_read_write_lock_example ( int argc, const char *argv[] )
+{
+
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    const char *policy_names[SYNC_RWLOCK_POLICY_QUANTITY] = { "reader preference", "writer preference", "phase fair" };
+    #ifdef _WIN64
+        HANDLE threads[RW_LOCK_EXAMPLE_READERS + RW_LOCK_EXAMPLE_WRITERS + RW_LOCK_EXAMPLE_UPGRADERS] = { 0 };
+    #else
+        pthread_t threads[RW_LOCK_EXAMPLE_READERS + RW_LOCK_EXAMPLE_WRITERS + RW_LOCK_EXAMPLE_UPGRADERS] = { 0 };
+        void *p_result = (void *) 0;
+    #endif
+    bool failed = false;
+
+    // Formatting
+    log_info(
+        "╭─────────────────────────╮\n"\
+        "│ read write lock example │\n"\
+        "╰─────────────────────────╯\n"\
+        "In this example, %d readers, %d writers and %d upgraders share a pair of counters under a\n"\
+        "read write lock, once with each policy. Readers check the counters. Writers add 1 to each\n"\
+        "counter. Upgraders take an upgradable read lock, upgrade it to add 1 to each counter, then\n"\
+        "downgrade it. Every thread counts any holder that overlaps it when it shouldn't\n\n",
+        RW_LOCK_EXAMPLE_READERS, RW_LOCK_EXAMPLE_WRITERS, RW_LOCK_EXAMPLE_UPGRADERS
+    );
+
+    // Run the example with each policy
+    for (rwlock_policy policy = SYNC_RWLOCK_PREFER_READER; policy < SYNC_RWLOCK_POLICY_QUANTITY; policy++)
+    {
+
+        // Initialized data
+        struct read_write_lock_example_s example = { 0 };
+        bool correct = true;
+
+        // Create
+        if ( rwlock_create_policy(&example.lock, policy) == 0 ) return 0;
+
+        // Start the readers
+        for (size_t i = 0; i < RW_LOCK_EXAMPLE_READERS; i++)
+        {
+            #ifdef _WIN64
+                threads[i] = CreateThread(NULL, 0, sync_read_write_lock_example_reader, &example, 0, NULL);
+            #else
+                (void) pthread_create(&threads[i], NULL, sync_read_write_lock_example_reader, &example);
+            #endif
+        }
+
+        // Start the writers
+        for (size_t i = RW_LOCK_EXAMPLE_READERS; i < RW_LOCK_EXAMPLE_READERS + RW_LOCK_EXAMPLE_WRITERS; i++)
+        {
+            #ifdef _WIN64
+                threads[i] = CreateThread(NULL, 0, sync_read_write_lock_example_writer, &example, 0, NULL);
+            #else
+                (void) pthread_create(&threads[i], NULL, sync_read_write_lock_example_writer, &example);
+            #endif
+        }
+
+        // Start the upgraders
+        for (size_t i = RW_LOCK_EXAMPLE_READERS + RW_LOCK_EXAMPLE_WRITERS; i < RW_LOCK_EXAMPLE_READERS + RW_LOCK_EXAMPLE_WRITERS + RW_LOCK_EXAMPLE_UPGRADERS; i++)
+        {
+            #ifdef _WIN64
+                threads[i] = CreateThread(NULL, 0, sync_read_write_lock_example_upgrader, &example, 0, NULL);
+            #else
+                (void) pthread_create(&threads[i], NULL, sync_read_write_lock_example_upgrader, &example);
+            #endif
+        }
+
+        // Join the threads
+        for (size_t i = 0; i < RW_LOCK_EXAMPLE_READERS + RW_LOCK_EXAMPLE_WRITERS + RW_LOCK_EXAMPLE_UPGRADERS; i++)
+        {
+            #ifdef _WIN64
+                DWORD result = 0;
+                WaitForSingleObject(threads[i], INFINITE);
+                GetExitCodeThread(threads[i], &result);
+                CloseHandle(threads[i]);
+                if ( result ) failed = true;
+            #else
+                (void) pthread_join(threads[i], &p_result);
+                if ( p_result ) failed = true;
+            #endif
+        }
+
+        // Check for overlaps and lost updates
+        if ( example.overlaps ) correct = false;
+        if ( example.a != ( RW_LOCK_EXAMPLE_WRITERS + RW_LOCK_EXAMPLE_UPGRADERS ) * RW_LOCK_EXAMPLE_ITERATIONS || example.b != example.a ) correct = false;
+        if ( correct == false ) failed = true;
+
+        // Print the result
+        printf("%s: %zu overlaps, and %zu updates %s\n", policy_names[policy], example.overlaps, example.a, correct ? "correctly" : "incorrectly");
+
+        // Destroy
+        (void) rwlock_destroy(&example.lock);
+    }
+
+    // Format
+    putchar('\n');
+
+    // Success
+    return failed == false;
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_read_write_lock_example_reader ( LPVOID p_parameter )
+#else
+void *sync_read_write_lock_example_reader ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct read_write_lock_example_s *p_example = p_parameter;
+
+    // Check the counters, many times
+    for (size_t i = 0; i < RW_LOCK_EXAMPLE_ITERATIONS; i++)
+    {
+
+        // Lock for reading
+        if ( rwlock_lock_rd(&p_example->lock) == 0 ) goto failed;
+
+        // Count readers. A writer must not overlap this
+        __atomic_fetch_add(&p_example->readers, 1, __ATOMIC_SEQ_CST);
+        if ( __atomic_load_n(&p_example->writers, __ATOMIC_SEQ_CST) || p_example->a != p_example->b ) __atomic_fetch_add(&p_example->overlaps, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_sub(&p_example->readers, 1, __ATOMIC_SEQ_CST);
+
+        // Unlock
+        if ( rwlock_unlock(&p_example->lock) == 0 ) goto failed;
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_read_write_lock_example_writer ( LPVOID p_parameter )
+#else
+void *sync_read_write_lock_example_writer ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct read_write_lock_example_s *p_example = p_parameter;
+
+    // Add 1 to each counter, many times
+    for (size_t i = 0; i < RW_LOCK_EXAMPLE_ITERATIONS; i++)
+    {
+
+        // Lock for writing
+        if ( rwlock_lock_wr(&p_example->lock) == 0 ) goto failed;
+
+        // Count writers. Nobody else may overlap this
+        if ( __atomic_add_fetch(&p_example->writers, 1, __ATOMIC_SEQ_CST) != 1 ||
+             __atomic_load_n(&p_example->readers, __ATOMIC_SEQ_CST)           ||
+             __atomic_load_n(&p_example->upgraders, __ATOMIC_SEQ_CST) ) __atomic_fetch_add(&p_example->overlaps, 1, __ATOMIC_RELAXED);
+
+        // ... Critical section ...
+        p_example->a++;
+        p_example->b++;
+
+        // Done writing
+        __atomic_fetch_sub(&p_example->writers, 1, __ATOMIC_SEQ_CST);
+
+        // Unlock
+        if ( rwlock_unlock(&p_example->lock) == 0 ) goto failed;
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_read_write_lock_example_upgrader ( LPVOID p_parameter )
+#else
+void *sync_read_write_lock_example_upgrader ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct read_write_lock_example_s *p_example = p_parameter;
+
+    // Upgrade, add 1 to each counter, and downgrade, many times
+    for (size_t i = 0; i < RW_LOCK_EXAMPLE_ITERATIONS; i++)
+    {
+
+        // Lock for reading, and exclude writers and other upgraders
+        if ( rwlock_lock_upgradable(&p_example->lock) == 0 ) goto failed;
+
+        // Count upgraders. Readers may overlap this, writers and upgraders must not
+        if ( __atomic_add_fetch(&p_example->upgraders, 1, __ATOMIC_SEQ_CST) != 1 ||
+             __atomic_load_n(&p_example->writers, __ATOMIC_SEQ_CST) ) __atomic_fetch_add(&p_example->overlaps, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_sub(&p_example->upgraders, 1, __ATOMIC_SEQ_CST);
+
+        // Upgrade to a write lock, without unlocking
+        if ( rwlock_upgrade(&p_example->lock) == 0 ) goto failed;
+
+        // Count writers. Nobody else may overlap this
+        if ( __atomic_add_fetch(&p_example->writers, 1, __ATOMIC_SEQ_CST) != 1 ||
+             __atomic_load_n(&p_example->readers, __ATOMIC_SEQ_CST)           ||
+             __atomic_load_n(&p_example->upgraders, __ATOMIC_SEQ_CST) ) __atomic_fetch_add(&p_example->overlaps, 1, __ATOMIC_RELAXED);
+
+        // ... Critical section ...
+        p_example->a++;
+        p_example->b++;
+
+        // Done writing
+        __atomic_fetch_sub(&p_example->writers, 1, __ATOMIC_SEQ_CST);
+
+        // Downgrade to a read lock, without unlocking
+        if ( rwlock_downgrade(&p_example->lock) == 0 ) goto failed;
+
+        // Check the counters as a reader
+        if ( p_example->a != p_example->b ) __atomic_fetch_add(&p_example->overlaps, 1, __ATOMIC_RELAXED);
+
+        // Unlock
+        if ( rwlock_unlock(&p_example->lock) == 0 ) goto failed;
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+int sync_semaphore_example ( int argc, const char *argv[] )
+{
+
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    struct semaphore_example_s example = { 0 };
+    #ifdef _WIN64
+        HANDLE threads[SEMAPHORE_EXAMPLE_THREADS] = { 0 };
+    #else
+        pthread_t threads[SEMAPHORE_EXAMPLE_THREADS] = { 0 };
+        void *p_result = (void *) 0;
+    #endif
+    bool failed = false;
+
+    // Formatting
+    log_info(
+        "╭───────────────────╮\n"\
+        "│ semaphore example │\n"\
+        "╰───────────────────╯\n"\
+        "In this example, %d threads share a semaphore with %d units. Half of the threads take 1 unit\n"\
+        "at a time with semaphore_wait, and the other half take 2 at a time with semaphore_wait_n.\n"\
+        "Each thread checks that no more units are in use than the semaphore holds\n\n",
+        SEMAPHORE_EXAMPLE_THREADS, SEMAPHORE_EXAMPLE_UNITS
+    );
+
+    // Create
+    if ( semaphore_create(&example.semaphore, SEMAPHORE_EXAMPLE_UNITS) == 0 ) return 0;
+
+    // Start the threads
+    for (size_t i = 0; i < SEMAPHORE_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_semaphore_example_thread, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_semaphore_example_thread, &example);
+        #endif
+    }
+
+    // Join the threads
+    for (size_t i = 0; i < SEMAPHORE_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            DWORD result = 0;
+            WaitForSingleObject(threads[i], INFINITE);
+            GetExitCodeThread(threads[i], &result);
+            CloseHandle(threads[i]);
+            if ( result ) failed = true;
+        #else
+            (void) pthread_join(threads[i], &p_result);
+            if ( p_result ) failed = true;
+        #endif
+    }
+
+    // Check the units
+    if ( example.overused ) failed = true;
+
+    // Print the result
+    printf("%d threads shared %d units %s\n", SEMAPHORE_EXAMPLE_THREADS, SEMAPHORE_EXAMPLE_UNITS, failed ? "incorrectly" : "correctly");
+
+    // Destroy
+    (void) semaphore_destroy(&example.semaphore);
+
+    // Format
+    putchar('\n');
+
+    // Success
+    return failed == false;
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_semaphore_example_thread ( LPVOID p_parameter )
+#else
+void *sync_semaphore_example_thread ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct semaphore_example_s *p_example = p_parameter;
+    unsigned int units = ( __atomic_fetch_add(&p_example->started, 1, __ATOMIC_RELAXED) % 2 ) + 1;
+
+    // Take units, and return them, many times
+    for (size_t i = 0; i < SEMAPHORE_EXAMPLE_ITERATIONS; i++)
+    {
+
+        // Wait for units
+        if ( ( units == 1 ? semaphore_wait(&p_example->semaphore) : semaphore_wait_n(&p_example->semaphore, units) ) == 0 ) goto failed;
+
+        // Count the units in use. There may never be more than the semaphore holds
+        if ( __atomic_add_fetch(&p_example->in_use, units, __ATOMIC_RELAXED) > SEMAPHORE_EXAMPLE_UNITS ) __atomic_fetch_add(&p_example->overused, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_sub(&p_example->in_use, units, __ATOMIC_RELAXED);
+
+        // Return the units
+        if ( ( units == 1 ? semaphore_signal(&p_example->semaphore) : semaphore_signal_n(&p_example->semaphore, units) ) == 0 ) goto failed;
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+int sync_condition_variable_example ( int argc, const char *argv[] )
+{
+
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    condition_variable c = { 0 };
+    
+    // Formatting
+    log_info(
+        "╭────────────────────────────╮\n"\
+        "│ condition variable example │\n"\
+        "╰────────────────────────────╯\n"\
+        "TODO\n\n"
+    );
+
+    // Create
+    if ( condition_variable_create(&c) == 0 ) return EXIT_FAILURE;
+
+    // TODO
+    // 
+
+    // Destroy
+    (void) condition_variable_destroy(&c);
+
+    // Success
+    return 1;
+}
+
+int sync_monitor_example ( int argc, const char *argv[] )
+{
+
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    struct monitor_example_s example = { 0 };
+    const size_t expected = MONITOR_EXAMPLE_PRODUCERS * ( (size_t) MONITOR_EXAMPLE_ITEMS * ( MONITOR_EXAMPLE_ITEMS + 1 ) / 2 );
+    #ifdef _WIN64
+        HANDLE threads[MONITOR_EXAMPLE_PRODUCERS + MONITOR_EXAMPLE_CONSUMERS] = { 0 };
+    #else
+        pthread_t threads[MONITOR_EXAMPLE_PRODUCERS + MONITOR_EXAMPLE_CONSUMERS] = { 0 };
+        void *p_result = (void *) 0;
+    #endif
+    bool failed = false;
+
+    // Formatting
+    log_info(
+        "╭─────────────────╮\n"\
+        "│ monitor example │\n"\
+        "╰─────────────────╯\n"\
+        "In this example, %d producers put numbers into a buffer of %d items, and %d consumers\n"\
+        "take them out, and sum them. Producers wait on the \"not_full\" queue of a monitor, and\n"\
+        "consumers wait on the \"not_empty\" queue, so each notification only wakes threads that\n"\
+        "can make progress\n\n",
+        MONITOR_EXAMPLE_PRODUCERS, MONITOR_EXAMPLE_CAPACITY, MONITOR_EXAMPLE_CONSUMERS
+    );
+
+    // Create
+    if ( monitor_create(&example.monitor) == 0 ) return 0;
+
+    // Name a queue for each condition
+    if ( monitor_queue(&example.monitor, "not_full" , &example.not_full ) == 0 ) return 0;
+    if ( monitor_queue(&example.monitor, "not_empty", &example.not_empty) == 0 ) return 0;
+
+    // Start the producers
+    for (size_t i = 0; i < MONITOR_EXAMPLE_PRODUCERS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_monitor_example_producer, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_monitor_example_producer, &example);
+        #endif
+    }
+
+    // Start the consumers
+    for (size_t i = MONITOR_EXAMPLE_PRODUCERS; i < MONITOR_EXAMPLE_PRODUCERS + MONITOR_EXAMPLE_CONSUMERS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_monitor_example_consumer, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_monitor_example_consumer, &example);
+        #endif
+    }
+
+    // Join the threads
+    for (size_t i = 0; i < MONITOR_EXAMPLE_PRODUCERS + MONITOR_EXAMPLE_CONSUMERS; i++)
+    {
+        #ifdef _WIN64
+            DWORD result = 0;
+            WaitForSingleObject(threads[i], INFINITE);
+            GetExitCodeThread(threads[i], &result);
+            CloseHandle(threads[i]);
+            if ( result ) failed = true;
+        #else
+            (void) pthread_join(threads[i], &p_result);
+            if ( p_result ) failed = true;
+        #endif
+    }
+
+    // Check the sum
+    if ( example.sum != expected ) failed = true;
+
+    // Print the result
+    printf("%d consumers summed %zu, expected %zu %s\n", MONITOR_EXAMPLE_CONSUMERS, example.sum, expected, failed ? "incorrectly" : "correctly");
+
+    // Destroy
+    (void) monitor_destroy(&example.monitor);
+
+    // Format
+    putchar('\n');
+
+    // Success
+    return failed == false;
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_monitor_example_producer ( LPVOID p_parameter )
+#else
+void *sync_monitor_example_producer ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct monitor_example_s *p_example = p_parameter;
+
+    // Put the numbers 1 .. n into the buffer
+    for (size_t i = 1; i <= MONITOR_EXAMPLE_ITEMS; i++)
+    {
+
+        // Enter the monitor
+        if ( monitor_enter(&p_example->monitor) == 0 ) goto failed;
+
+        // Wait for room
+        if ( monitor_wait_until(&p_example->monitor, p_example->not_full, sync_monitor_example_not_full, p_example) == 0 ) goto failed;
+
+        // Put the number into the buffer
+        p_example->items[p_example->tail++ % MONITOR_EXAMPLE_CAPACITY] = i;
+        p_example->count++;
+
+        // Wake a consumer
+        (void) monitor_notify_queue(&p_example->monitor, p_example->not_empty);
+
+        // Exit the monitor
+        if ( monitor_exit(&p_example->monitor) == 0 ) goto failed;
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_monitor_example_consumer ( LPVOID p_parameter )
+#else
+void *sync_monitor_example_consumer ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct monitor_example_s *p_example = p_parameter;
+
+    // Take this consumer's share of the numbers out of the buffer
+    for (size_t i = 0; i < MONITOR_EXAMPLE_PRODUCERS * MONITOR_EXAMPLE_ITEMS / MONITOR_EXAMPLE_CONSUMERS; i++)
+    {
+
+        // Enter the monitor
+        if ( monitor_enter(&p_example->monitor) == 0 ) goto failed;
+
+        // Wait for a number
+        if ( monitor_wait_until(&p_example->monitor, p_example->not_empty, sync_monitor_example_not_empty, p_example) == 0 ) goto failed;
+
+        // Take the number out of the buffer, and sum it
+        p_example->sum += p_example->items[p_example->head++ % MONITOR_EXAMPLE_CAPACITY];
+        p_example->count--;
+
+        // Wake a producer
+        (void) monitor_notify_queue(&p_example->monitor, p_example->not_full);
+
+        // Exit the monitor
+        if ( monitor_exit(&p_example->monitor) == 0 ) goto failed;
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+bool sync_monitor_example_not_full ( void *p_context )
+{
+
+    // Initialized data
+    struct monitor_example_s *p_example = p_context;
+
+    // Done
+    return p_example->count < MONITOR_EXAMPLE_CAPACITY;
+}
+
+bool sync_monitor_example_not_empty ( void *p_context )
+{
+
+    // Initialized data
+    struct monitor_example_s *p_example = p_context;
+
+    // Done
+    return p_example->count > 0;
+}
+
+int sync_barrier_example ( int argc, const char *argv[] )
+{
+
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    barrier b = { 0 }, first = { 0 };
+    #ifdef _WIN64
+        HANDLE threads[BARRIER_EXAMPLE_THREADS] = { 0 };
+    #else
+        pthread_t threads[BARRIER_EXAMPLE_THREADS] = { 0 };
+        void *p_result = (void *) 0;
+    #endif
+    bool failed = false;
+    
+    // Formatting
+    log_info(
+        "╭─────────────────╮\n"\
+        "│ barrier example │\n"\
+        "╰─────────────────╯\n"\
+        "In this example, %d threads meet at a barrier %d times. Each time, every thread\n"\
+        "adds 1 to a sum at the barrier, and checks the sum. The main thread waits at a\n"\
+        "barrier first, so the threads don't start at the first leaf of the barrier\n\n",
+        BARRIER_EXAMPLE_THREADS, BARRIER_EXAMPLE_PHASES
+    );
+
+    // Create
+    if ( barrier_create(&first, 1) == 0 ) return EXIT_FAILURE;
+    if ( barrier_create(&b, BARRIER_EXAMPLE_THREADS) == 0 ) return EXIT_FAILURE;
+
+    // Wait at a barrier on the main thread, so the other threads are 1 .. n
+    (void) barrier_wait(&first);
+
+    // Start the threads
+    for (size_t i = 0; i < BARRIER_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_barrier_example_thread, &b, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_barrier_example_thread, &b);
+        #endif
+    }
+
+    // Join the threads
+    for (size_t i = 0; i < BARRIER_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            DWORD result = 0;
+            WaitForSingleObject(threads[i], INFINITE);
+            GetExitCodeThread(threads[i], &result);
+            CloseHandle(threads[i]);
+            if ( result ) failed = true;
+        #else
+            (void) pthread_join(threads[i], &p_result);
+            if ( p_result ) failed = true;
+        #endif
+    }
+
+    // Print the result
+    printf("%d threads summed at the barrier %d times %s\n", BARRIER_EXAMPLE_THREADS, BARRIER_EXAMPLE_PHASES, failed ? "incorrectly" : "correctly");
+
+    // Destroy
+    (void) barrier_destroy(&b);
+    (void) barrier_destroy(&first);
+
+    // Format
+    putchar('\n');
+    
+    // Success
+    return failed == false;
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_barrier_example_thread ( LPVOID p_parameter )
+#else
+void *sync_barrier_example_thread ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    barrier *p_barrier = p_parameter;
+    double sum = 0;
+
+    for (int i = 0; i < BARRIER_EXAMPLE_PHASES; i++)
+    {
+
+        // Sum 1 from each thread
+        sum = 1;
+        if ( barrier_wait_reduce(p_barrier, &sum, barrier_reduce_sum) == 0 ) goto failed;
+
+        // Check the sum
+        if ( (int) sum != BARRIER_EXAMPLE_THREADS ) goto failed;
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+int sync_fast_mutex_example ( int argc, const char *argv[] )
+{
+
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    struct fast_mutex_example_s example = { 0 };
+    #ifdef _WIN64
+        HANDLE threads[FAST_MUTEX_EXAMPLE_THREADS] = { 0 };
+    #else
+        pthread_t threads[FAST_MUTEX_EXAMPLE_THREADS] = { 0 };
+        void *p_result = (void *) 0;
+    #endif
+    bool failed = false;
+
+    // Formatting
+    log_info(
+        "╭────────────────────╮\n"\
+        "│ fast mutex example │\n"\
+        "╰────────────────────╯\n"\
+        "In this example, %d threads each add 1 to a counter %d times, while holding a fast mutex.\n"\
+        "An uncontended lock and unlock is a single atomic operation. Contended threads sleep on a futex\n\n",
+        FAST_MUTEX_EXAMPLE_THREADS, FAST_MUTEX_EXAMPLE_ITERATIONS
+    );
+
+    // Create
+    if ( fast_mutex_create(&example.lock) == 0 ) return 0;
+
+    // Start the threads
+    for (size_t i = 0; i < FAST_MUTEX_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_fast_mutex_example_thread, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_fast_mutex_example_thread, &example);
+        #endif
+    }
+
+    // Join the threads
+    for (size_t i = 0; i < FAST_MUTEX_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            DWORD result = 0;
+            WaitForSingleObject(threads[i], INFINITE);
+            GetExitCodeThread(threads[i], &result);
+            CloseHandle(threads[i]);
+            if ( result ) failed = true;
+        #else
+            (void) pthread_join(threads[i], &p_result);
+            if ( p_result ) failed = true;
+        #endif
+    }
+
+    // Check the counter
+    if ( example.count != FAST_MUTEX_EXAMPLE_THREADS * FAST_MUTEX_EXAMPLE_ITERATIONS ) failed = true;
+
+    // Print the result
+    printf("%d threads counted to %zu %s\n", FAST_MUTEX_EXAMPLE_THREADS, example.count, failed ? "incorrectly" : "correctly");
+
+    // Destroy
+    (void) fast_mutex_destroy(&example.lock);
+
+    // Format
+    putchar('\n');
+
+    // Success
+    return failed == false;
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_fast_mutex_example_thread ( LPVOID p_parameter )
+#else
+void *sync_fast_mutex_example_thread ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct fast_mutex_example_s *p_example = p_parameter;
+
+    // Add 1 to the counter, many times
+    for (size_t i = 0; i < FAST_MUTEX_EXAMPLE_ITERATIONS; i++)
+    {
+
+        // Lock
+        if ( fast_mutex_lock(&p_example->lock) == 0 ) goto failed;
+
+        // ... Critical section ...
+        p_example->count++;
+
+        // Unlock
+        if ( fast_mutex_unlock(&p_example->lock) == 0 ) goto failed;
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+int sync_adaptive_mutex_example ( int argc, const char *argv[] )
+{
+
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    struct adaptive_mutex_example_s example = { 0 };
+    #ifdef _WIN64
+        HANDLE threads[ADAPTIVE_MUTEX_EXAMPLE_THREADS] = { 0 };
+    #else
+        pthread_t threads[ADAPTIVE_MUTEX_EXAMPLE_THREADS] = { 0 };
+        void *p_result = (void *) 0;
+    #endif
+    bool failed = false;
+
+    // Formatting
+    log_info(
+        "╭────────────────────────╮\n"\
+        "│ adaptive mutex example │\n"\
+        "╰────────────────────────╯\n"\
+        "In this example, %d threads each add 1 to a counter %d times, while holding an adaptive mutex.\n"\
+        "A thread that finds the mutex locked spins for about as long as the mutex is usually held,\n"\
+        "then sleeps on a futex\n\n",
+        ADAPTIVE_MUTEX_EXAMPLE_THREADS, ADAPTIVE_MUTEX_EXAMPLE_ITERATIONS
+    );
+
+    // Create
+    if ( adaptive_mutex_create(&example.lock) == 0 ) return 0;
+
+    // Start the threads
+    for (size_t i = 0; i < ADAPTIVE_MUTEX_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_adaptive_mutex_example_thread, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_adaptive_mutex_example_thread, &example);
+        #endif
+    }
+
+    // Join the threads
+    for (size_t i = 0; i < ADAPTIVE_MUTEX_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            DWORD result = 0;
+            WaitForSingleObject(threads[i], INFINITE);
+            GetExitCodeThread(threads[i], &result);
+            CloseHandle(threads[i]);
+            if ( result ) failed = true;
+        #else
+            (void) pthread_join(threads[i], &p_result);
+            if ( p_result ) failed = true;
+        #endif
+    }
+
+    // Check the counter
+    if ( example.count != ADAPTIVE_MUTEX_EXAMPLE_THREADS * ADAPTIVE_MUTEX_EXAMPLE_ITERATIONS ) failed = true;
+
+    // Print the result
+    printf("%d threads counted to %zu %s\n", ADAPTIVE_MUTEX_EXAMPLE_THREADS, example.count, failed ? "incorrectly" : "correctly");
+
+    // Destroy
+    (void) adaptive_mutex_destroy(&example.lock);
+
+    // Format
+    putchar('\n');
+
+    // Success
+    return failed == false;
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_adaptive_mutex_example_thread ( LPVOID p_parameter )
+#else
+void *sync_adaptive_mutex_example_thread ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct adaptive_mutex_example_s *p_example = p_parameter;
+
+    // Add 1 to the counter, many times
+    for (size_t i = 0; i < ADAPTIVE_MUTEX_EXAMPLE_ITERATIONS; i++)
+    {
+
+        // Lock
+        if ( adaptive_mutex_lock(&p_example->lock) == 0 ) goto failed;
+
+        // ... Critical section ...
+        p_example->count++;
+
+        // Unlock
+        if ( adaptive_mutex_unlock(&p_example->lock) == 0 ) goto failed;
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+int sync_mcs_spinlock_example ( int argc, const char *argv[] )
+{
+
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    struct mcs_spinlock_example_s example = { 0 };
+    #ifdef _WIN64
+        HANDLE threads[MCS_SPINLOCK_EXAMPLE_THREADS] = { 0 };
+    #else
+        pthread_t threads[MCS_SPINLOCK_EXAMPLE_THREADS] = { 0 };
+        void *p_result = (void *) 0;
+    #endif
+    bool failed = false;
+
+    // Formatting
+    log_info(
+        "╭──────────────────────╮\n"\
+        "│ MCS spinlock example │\n"\
+        "╰──────────────────────╯\n"\
+        "In this example, %d threads each add 1 to a counter %d times, while holding an MCS spinlock.\n"\
+        "Each thread queues on its own node, and spins only on that node until the lock is handed to it\n\n",
+        MCS_SPINLOCK_EXAMPLE_THREADS, MCS_SPINLOCK_EXAMPLE_ITERATIONS
+    );
+
+    // Create
+    if ( mcs_spinlock_create(&example.lock) == 0 ) return 0;
+
+    // Start the threads
+    for (size_t i = 0; i < MCS_SPINLOCK_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_mcs_spinlock_example_thread, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_mcs_spinlock_example_thread, &example);
+        #endif
+    }
+
+    // Join the threads
+    for (size_t i = 0; i < MCS_SPINLOCK_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            DWORD result = 0;
+            WaitForSingleObject(threads[i], INFINITE);
+            GetExitCodeThread(threads[i], &result);
+            CloseHandle(threads[i]);
+            if ( result ) failed = true;
+        #else
+            (void) pthread_join(threads[i], &p_result);
+            if ( p_result ) failed = true;
+        #endif
+    }
+
+    // Check the counter
+    if ( example.count != MCS_SPINLOCK_EXAMPLE_THREADS * MCS_SPINLOCK_EXAMPLE_ITERATIONS ) failed = true;
+
+    // Print the result
+    printf("%d threads counted to %zu %s\n", MCS_SPINLOCK_EXAMPLE_THREADS, example.count, failed ? "incorrectly" : "correctly");
+
+    // Destroy
+    (void) mcs_spinlock_destroy(&example.lock);
+
+    // Format
+    putchar('\n');
+
+    // Success
+    return failed == false;
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_mcs_spinlock_example_thread ( LPVOID p_parameter )
+#else
+void *sync_mcs_spinlock_example_thread ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct mcs_spinlock_example_s *p_example = p_parameter;
+    mcs_node node = { 0 };
+
+    // Add 1 to the counter, many times
+    for (size_t i = 0; i < MCS_SPINLOCK_EXAMPLE_ITERATIONS; i++)
+    {
+
+        // Lock
+        if ( mcs_spinlock_lock(&p_example->lock, &node) == 0 ) goto failed;
+
+        // ... Critical section ...
+        p_example->count++;
+
+        // Unlock
+        if ( mcs_spinlock_unlock(&p_example->lock, &node) == 0 ) goto failed;
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+int sync_ticket_spinlock_example ( int argc, const char *argv[] )
+{
+
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    struct ticket_spinlock_example_s example = { 0 };
+    #ifdef _WIN64
+        HANDLE threads[TICKET_SPINLOCK_EXAMPLE_THREADS] = { 0 };
+    #else
+        pthread_t threads[TICKET_SPINLOCK_EXAMPLE_THREADS] = { 0 };
+        void *p_result = (void *) 0;
+    #endif
+    bool failed = false;
+
+    // Formatting
+    log_info(
+        "╭─────────────────────────╮\n"\
+        "│ ticket spinlock example │\n"\
+        "╰─────────────────────────╯\n"\
+        "In this example, %d threads each add 1 to a counter %d times, while holding a ticket spinlock.\n"\
+        "Threads take the lock in the order they took their tickets\n\n",
+        TICKET_SPINLOCK_EXAMPLE_THREADS, TICKET_SPINLOCK_EXAMPLE_ITERATIONS
+    );
+
+    // Create
+    if ( ticket_spinlock_create(&example.lock) == 0 ) return 0;
+
+    // Start the threads
+    for (size_t i = 0; i < TICKET_SPINLOCK_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_ticket_spinlock_example_thread, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_ticket_spinlock_example_thread, &example);
+        #endif
+    }
+
+    // Join the threads
+    for (size_t i = 0; i < TICKET_SPINLOCK_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            DWORD result = 0;
+            WaitForSingleObject(threads[i], INFINITE);
+            GetExitCodeThread(threads[i], &result);
+            CloseHandle(threads[i]);
+            if ( result ) failed = true;
+        #else
+            (void) pthread_join(threads[i], &p_result);
+            if ( p_result ) failed = true;
+        #endif
+    }
+
+    // Check the counter
+    if ( example.count != TICKET_SPINLOCK_EXAMPLE_THREADS * TICKET_SPINLOCK_EXAMPLE_ITERATIONS ) failed = true;
+
+    // Print the result
+    printf("%d threads counted to %zu %s\n", TICKET_SPINLOCK_EXAMPLE_THREADS, example.count, failed ? "incorrectly" : "correctly");
+
+    // Destroy
+    (void) ticket_spinlock_destroy(&example.lock);
+
+    // Format
+    putchar('\n');
+
+    // Success
+    return failed == false;
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_ticket_spinlock_example_thread ( LPVOID p_parameter )
+#else
+void *sync_ticket_spinlock_example_thread ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct ticket_spinlock_example_s *p_example = p_parameter;
+
+    // Add 1 to the counter, many times
+    for (size_t i = 0; i < TICKET_SPINLOCK_EXAMPLE_ITERATIONS; i++)
+    {
+
+        // Lock
+        if ( ticket_spinlock_lock(&p_example->lock) == 0 ) goto failed;
+
+        // ... Critical section ...
+        p_example->count++;
+
+        // Unlock
+        if ( ticket_spinlock_unlock(&p_example->lock) == 0 ) goto failed;
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+int sync_ttas_spinlock_example ( int argc, const char *argv[] )
+{
+
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    struct ttas_spinlock_example_s example = { 0 };
+    #ifdef _WIN64
+        HANDLE threads[TTAS_SPINLOCK_EXAMPLE_THREADS] = { 0 };
+    #else
+        pthread_t threads[TTAS_SPINLOCK_EXAMPLE_THREADS] = { 0 };
+        void *p_result = (void *) 0;
+    #endif
+    bool failed = false;
+
+    // Formatting
+    log_info(
+        "╭───────────────────────╮\n"\
+        "│ TTAS spinlock example │\n"\
+        "╰───────────────────────╯\n"\
+        "In this example, %d threads each add 1 to a counter %d times, while holding a TTAS spinlock.\n"\
+        "Waiting threads spin on a read of the lock, and back off after each lost exchange\n\n",
+        TTAS_SPINLOCK_EXAMPLE_THREADS, TTAS_SPINLOCK_EXAMPLE_ITERATIONS
+    );
+
+    // Create
+    if ( ttas_spinlock_create(&example.lock) == 0 ) return 0;
+
+    // Start the threads
+    for (size_t i = 0; i < TTAS_SPINLOCK_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_ttas_spinlock_example_thread, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_ttas_spinlock_example_thread, &example);
+        #endif
+    }
+
+    // Join the threads
+    for (size_t i = 0; i < TTAS_SPINLOCK_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            DWORD result = 0;
+            WaitForSingleObject(threads[i], INFINITE);
+            GetExitCodeThread(threads[i], &result);
+            CloseHandle(threads[i]);
+            if ( result ) failed = true;
+        #else
+            (void) pthread_join(threads[i], &p_result);
+            if ( p_result ) failed = true;
+        #endif
+    }
+
+    // Check the counter
+    if ( example.count != TTAS_SPINLOCK_EXAMPLE_THREADS * TTAS_SPINLOCK_EXAMPLE_ITERATIONS ) failed = true;
+
+    // Print the result
+    printf("%d threads counted to %zu %s\n", TTAS_SPINLOCK_EXAMPLE_THREADS, example.count, failed ? "incorrectly" : "correctly");
+
+    // Destroy
+    (void) ttas_spinlock_destroy(&example.lock);
+
+    // Format
+    putchar('\n');
+
+    // Success
+    return failed == false;
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_ttas_spinlock_example_thread ( LPVOID p_parameter )
+#else
+void *sync_ttas_spinlock_example_thread ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct ttas_spinlock_example_s *p_example = p_parameter;
+
+    // Add 1 to the counter, many times
+    for (size_t i = 0; i < TTAS_SPINLOCK_EXAMPLE_ITERATIONS; i++)
+    {
+
+        // Lock
+        if ( ttas_spinlock_lock(&p_example->lock) == 0 ) goto failed;
+
+        // ... Critical section ...
+        p_example->count++;
+
+        // Unlock
+        if ( ttas_spinlock_unlock(&p_example->lock) == 0 ) goto failed;
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+int sync_brlock_example ( int argc, const char *argv[] )
+{
+
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    struct brlock_example_s example = { 0 };
+    #ifdef _WIN64
+        HANDLE threads[BRLOCK_EXAMPLE_READERS + BRLOCK_EXAMPLE_WRITERS] = { 0 };
+    #else
+        pthread_t threads[BRLOCK_EXAMPLE_READERS + BRLOCK_EXAMPLE_WRITERS] = { 0 };
+        void *p_result = (void *) 0;
+    #endif
+    bool failed = false;
+
+    // Formatting
+    log_info(
+        "╭─────────────────────────╮\n"\
+        "│ big reader lock example │\n"\
+        "╰─────────────────────────╯\n"\
+        "In this example, %d readers check a pair of counters while %d writers add 1 to both.\n"\
+        "Each reader takes a slot of its own, so readers never share a cache line. A writer\n"\
+        "waits for every slot to drain, so a reader never sees one counter without the other\n\n",
+        BRLOCK_EXAMPLE_READERS, BRLOCK_EXAMPLE_WRITERS
+    );
+
+    // Create
+    if ( brlock_create(&example.lock) == 0 ) return 0;
+
+    // Start the readers
+    for (size_t i = 0; i < BRLOCK_EXAMPLE_READERS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_brlock_example_reader, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_brlock_example_reader, &example);
+        #endif
+    }
+
+    // Start the writers
+    for (size_t i = BRLOCK_EXAMPLE_READERS; i < BRLOCK_EXAMPLE_READERS + BRLOCK_EXAMPLE_WRITERS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_brlock_example_writer, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_brlock_example_writer, &example);
+        #endif
+    }
+
+    // Join the threads
+    for (size_t i = 0; i < BRLOCK_EXAMPLE_READERS + BRLOCK_EXAMPLE_WRITERS; i++)
+    {
+        #ifdef _WIN64
+            DWORD result = 0;
+            WaitForSingleObject(threads[i], INFINITE);
+            GetExitCodeThread(threads[i], &result);
+            CloseHandle(threads[i]);
+            if ( result ) failed = true;
+        #else
+            (void) pthread_join(threads[i], &p_result);
+            if ( p_result ) failed = true;
+        #endif
+    }
+
+    // Check the counters
+    if ( example.a != BRLOCK_EXAMPLE_WRITERS * BRLOCK_EXAMPLE_WRITES || example.b != example.a ) failed = true;
+
+    // Print the result
+    printf("%d readers and %d writers shared the counters %s\n", BRLOCK_EXAMPLE_READERS, BRLOCK_EXAMPLE_WRITERS, failed ? "incorrectly" : "correctly");
+
+    // Destroy
+    (void) brlock_destroy(&example.lock);
+
+    // Format
+    putchar('\n');
+
+    // Success
+    return failed == false;
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_brlock_example_reader ( LPVOID p_parameter )
+#else
+void *sync_brlock_example_reader ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct brlock_example_s *p_example = p_parameter;
+
+    // Read the counters, many times
+    for (size_t i = 0; i < BRLOCK_EXAMPLE_READS; i++)
+    {
+
+        // Initialized data
+        bool equal = false;
+
+        // Lock for reading
+        if ( brlock_lock_rd(&p_example->lock) == 0 ) goto failed;
+
+        // ... Critical section ...
+        equal = ( p_example->a == p_example->b );
+
+        // Unlock
+        if ( brlock_unlock_rd(&p_example->lock) == 0 ) goto failed;
+
+        // Check the counters
+        if ( equal == false ) goto failed;
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_brlock_example_writer ( LPVOID p_parameter )
+#else
+void *sync_brlock_example_writer ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct brlock_example_s *p_example = p_parameter;
+
+    // Add 1 to each counter, many times
+    for (size_t i = 0; i < BRLOCK_EXAMPLE_WRITES; i++)
+    {
+
+        // Lock for writing
+        if ( brlock_lock_wr(&p_example->lock) == 0 ) goto failed;
+
+        // ... Critical section ...
+        p_example->a++;
+        p_example->b++;
+
+        // Unlock
+        if ( brlock_unlock_wr(&p_example->lock) == 0 ) goto failed;
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+int sync_seqlock_example ( int argc, const char *argv[] )
+{
+
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    struct seqlock_example_s example = { 0 };
+    #ifdef _WIN64
+        HANDLE threads[SEQLOCK_EXAMPLE_READERS + SEQLOCK_EXAMPLE_WRITERS] = { 0 };
+    #else
+        pthread_t threads[SEQLOCK_EXAMPLE_READERS + SEQLOCK_EXAMPLE_WRITERS] = { 0 };
+        void *p_result = (void *) 0;
+    #endif
+    bool failed = false;
+
+    // Formatting
+    log_info(
+        "╭─────────────────╮\n"\
+        "│ seqlock example │\n"\
+        "╰─────────────────╯\n"\
+        "In this example, %d readers copy a pair of counters while %d writer adds 1 to both.\n"\
+        "Readers never write to the sequence lock. A reader retries its copy if a write overlapped it,\n"\
+        "so a reader never sees one counter without the other\n\n",
+        SEQLOCK_EXAMPLE_READERS, SEQLOCK_EXAMPLE_WRITERS
+    );
+
+    // Create
+    if ( seqlock_create(&example.lock) == 0 ) return 0;
+
+    // Start the readers
+    for (size_t i = 0; i < SEQLOCK_EXAMPLE_READERS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_seqlock_example_reader, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_seqlock_example_reader, &example);
+        #endif
+    }
+
+    // Start the writers
+    for (size_t i = SEQLOCK_EXAMPLE_READERS; i < SEQLOCK_EXAMPLE_READERS + SEQLOCK_EXAMPLE_WRITERS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_seqlock_example_writer, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_seqlock_example_writer, &example);
+        #endif
+    }
+
+    // Join the threads
+    for (size_t i = 0; i < SEQLOCK_EXAMPLE_READERS + SEQLOCK_EXAMPLE_WRITERS; i++)
+    {
+        #ifdef _WIN64
+            DWORD result = 0;
+            WaitForSingleObject(threads[i], INFINITE);
+            GetExitCodeThread(threads[i], &result);
+            CloseHandle(threads[i]);
+            if ( result ) failed = true;
+        #else
+            (void) pthread_join(threads[i], &p_result);
+            if ( p_result ) failed = true;
+        #endif
+    }
+
+    // Check the counters
+    if ( example.a != SEQLOCK_EXAMPLE_WRITERS * SEQLOCK_EXAMPLE_WRITES || example.b != example.a ) failed = true;
+
+    // Print the result
+    printf("%d readers and %d writer shared the counters %s\n", SEQLOCK_EXAMPLE_READERS, SEQLOCK_EXAMPLE_WRITERS, failed ? "incorrectly" : "correctly");
+
+    // Destroy
+    (void) seqlock_destroy(&example.lock);
+
+    // Format
+    putchar('\n');
+
+    // Success
+    return failed == false;
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_seqlock_example_reader ( LPVOID p_parameter )
+#else
+void *sync_seqlock_example_reader ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct seqlock_example_s *p_example = p_parameter;
+
+    // Read the counters, many times
+    for (size_t i = 0; i < SEQLOCK_EXAMPLE_READS; i++)
+    {
+
+        // Initialized data
+        uint32_t sequence = 0;
+        size_t a = 0, b = 0;
+
+        // Copy the counters, until no write overlaps the copy
+        do
+        {
+
+            // Begin the read
+            sequence = seqlock_read_begin(&p_example->lock);
+
+            // Copy the counters. The writer may be storing them
+            a = __atomic_load_n(&p_example->a, __ATOMIC_RELAXED);
+            b = __atomic_load_n(&p_example->b, __ATOMIC_RELAXED);
+
+        } while ( seqlock_read_retry(&p_example->lock, sequence) );
+
+        // Check the copy
+        if ( a != b ) goto failed;
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_seqlock_example_writer ( LPVOID p_parameter )
+#else
+void *sync_seqlock_example_writer ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct seqlock_example_s *p_example = p_parameter;
+
+    // Add 1 to each counter, many times
+    for (size_t i = 0; i < SEQLOCK_EXAMPLE_WRITES; i++)
+    {
+
+        // Begin the write
+        if ( seqlock_write_begin(&p_example->lock) == 0 ) goto failed;
+
+        // Update the counters. Readers may be copying them
+        __atomic_store_n(&p_example->a, p_example->a + 1, __ATOMIC_RELAXED);
+        __atomic_store_n(&p_example->b, p_example->b + 1, __ATOMIC_RELAXED);
+
+        // End the write
+        if ( seqlock_write_end(&p_example->lock) == 0 ) goto failed;
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+int sync_rcu_example ( int argc, const char *argv[] )
+{
+
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    struct rcu_example_s example = { 0 };
+    #ifdef _WIN64
+        HANDLE threads[RCU_EXAMPLE_READERS + 1] = { 0 };
+    #else
+        pthread_t threads[RCU_EXAMPLE_READERS + 1] = { 0 };
+        void *p_result = (void *) 0;
+    #endif
+    bool failed = false;
+
+    // Formatting
+    log_info(
+        "╭──────────────────────────╮\n"\
+        "│ read copy update example │\n"\
+        "╰──────────────────────────╯\n"\
+        "In this example, %d readers read a shared node while an updater replaces it. The updater\n"\
+        "retires each node it replaces with rcu_call, or frees it after rcu_synchronize. A node is\n"\
+        "only reclaimed after every reader that could hold it has left its critical section\n\n",
+        RCU_EXAMPLE_READERS
+    );
+
+    // Allocate the first node
+    example.p_node = calloc(1, sizeof(struct rcu_example_node_s));
+    if ( example.p_node == (void *) 0 ) return 0;
+
+    // Populate the first node
+    example.p_node->p_example = &example;
+
+    // Start the readers
+    for (size_t i = 0; i < RCU_EXAMPLE_READERS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_rcu_example_reader, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_rcu_example_reader, &example);
+        #endif
+    }
+
+    // Start the updater
+    #ifdef _WIN64
+        threads[RCU_EXAMPLE_READERS] = CreateThread(NULL, 0, sync_rcu_example_updater, &example, 0, NULL);
+    #else
+        (void) pthread_create(&threads[RCU_EXAMPLE_READERS], NULL, sync_rcu_example_updater, &example);
+    #endif
+
+    // Join the threads
+    for (size_t i = 0; i < RCU_EXAMPLE_READERS + 1; i++)
+    {
+        #ifdef _WIN64
+            DWORD result = 0;
+            WaitForSingleObject(threads[i], INFINITE);
+            GetExitCodeThread(threads[i], &result);
+            CloseHandle(threads[i]);
+            if ( result ) failed = true;
+        #else
+            (void) pthread_join(threads[i], &p_result);
+            if ( p_result ) failed = true;
+        #endif
+    }
+
+    // Check the quantity of reclaimed nodes
+    if ( example.reclaimed != RCU_EXAMPLE_UPDATES ) failed = true;
+
+    // Print the result
+    printf("%d readers read while %zu nodes were reclaimed %s\n", RCU_EXAMPLE_READERS, example.reclaimed, failed ? "incorrectly" : "correctly");
+
+    // Free the last node
+    free(example.p_node);
+
+    // Format
+    putchar('\n');
+
+    // Success
+    return failed == false;
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_rcu_example_reader ( LPVOID p_parameter )
+#else
+void *sync_rcu_example_reader ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct rcu_example_s *p_example = p_parameter;
+
+    // Read the shared node, many times
+    for (size_t i = 0; i < RCU_EXAMPLE_READS; i++)
+    {
+
+        // Initialized data
+        struct rcu_example_node_s *p_node = (void *) 0;
+        bool whole = false;
+
+        // Enter a read side critical section
+        if ( rcu_read_lock() == 0 ) goto failed;
+
+        // Read the node. It can't be reclaimed until the critical section ends
+        p_node = __atomic_load_n(&p_example->p_node, __ATOMIC_ACQUIRE);
+        whole  = ( p_node->a == p_node->b );
+
+        // Leave the read side critical section
+        if ( rcu_read_unlock() == 0 ) goto failed;
+
+        // Check the node
+        if ( whole == false ) goto failed;
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_rcu_example_updater ( LPVOID p_parameter )
+#else
+void *sync_rcu_example_updater ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct rcu_example_s *p_example = p_parameter;
+
+    // Replace the shared node, many times
+    for (size_t i = 1; i <= RCU_EXAMPLE_UPDATES; i++)
+    {
+
+        // Initialized data
+        struct rcu_example_node_s *p_node = calloc(1, sizeof(struct rcu_example_node_s)),
+                                  *p_old  = (void *) 0;
+
+        // Error check
+        if ( p_node == (void *) 0 ) goto failed;
+
+        // Populate the node
+        p_node->a = i, p_node->b = i, p_node->p_example = p_example;
+
+        // Publish the node
+        p_old = __atomic_exchange_n(&p_example->p_node, p_node, __ATOMIC_ACQ_REL);
+
+        // Defer most reclamation to a batched callback
+        if ( i % RCU_EXAMPLE_SYNCHRONIZE_PERIOD )
+        {
+            if ( rcu_call(sync_rcu_example_reclaim, p_old) == 0 ) goto failed;
+        }
+
+        // Sometimes, wait for the readers, then reclaim directly
+        else
+        {
+            if ( rcu_synchronize() == 0 ) goto failed;
+            sync_rcu_example_reclaim(p_old);
+        }
+    }
+
+    // Run the deferred callbacks
+    if ( rcu_barrier() == 0 ) goto failed;
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+void sync_rcu_example_reclaim ( void *p_value )
+{
+
+    // Initialized data
+    struct rcu_example_node_s *p_node = p_value;
+
+    // Count the node
+    __atomic_fetch_add(&p_node->p_example->reclaimed, 1, __ATOMIC_RELAXED);
+
+    // Poison the node, so a reader that still held it would notice
+    p_node->a = 0, p_node->b = SIZE_MAX;
+
+    // Free the node
+    free(p_node);
+
+    // Done
+    return;
+}
+
+int sync_hazard_pointer_example ( int argc, const char *argv[] )
+{
+
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    struct hazard_pointer_example_s example = { 0 };
+    #ifdef _WIN64
+        HANDLE threads[HAZARD_POINTER_EXAMPLE_READERS + 1] = { 0 };
+    #else
+        pthread_t threads[HAZARD_POINTER_EXAMPLE_READERS + 1] = { 0 };
+        void *p_result = (void *) 0;
+    #endif
+    bool failed = false;
+
+    // Formatting
+    log_info(
+        "╭────────────────────────╮\n"\
+        "│ hazard pointer example │\n"\
+        "╰────────────────────────╯\n"\
+        "In this example, %d readers read a shared node while an updater replaces it. Each reader\n"\
+        "protects the node with a hazard pointer before reading it. The updater retires each node it\n"\
+        "replaces, and a node is only reclaimed once no hazard pointer protects it\n\n",
+        HAZARD_POINTER_EXAMPLE_READERS
+    );
+
+    // Allocate the first node
+    example.p_node = calloc(1, sizeof(struct hazard_pointer_example_node_s));
+    if ( example.p_node == (void *) 0 ) return 0;
+
+    // Populate the first node
+    example.p_node->p_example = &example;
+
+    // Start the readers
+    for (size_t i = 0; i < HAZARD_POINTER_EXAMPLE_READERS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_hazard_pointer_example_reader, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_hazard_pointer_example_reader, &example);
+        #endif
+    }
+
+    // Start the updater
+    #ifdef _WIN64
+        threads[HAZARD_POINTER_EXAMPLE_READERS] = CreateThread(NULL, 0, sync_hazard_pointer_example_updater, &example, 0, NULL);
+    #else
+        (void) pthread_create(&threads[HAZARD_POINTER_EXAMPLE_READERS], NULL, sync_hazard_pointer_example_updater, &example);
+    #endif
+
+    // Join the threads
+    for (size_t i = 0; i < HAZARD_POINTER_EXAMPLE_READERS + 1; i++)
+    {
+        #ifdef _WIN64
+            DWORD result = 0;
+            WaitForSingleObject(threads[i], INFINITE);
+            GetExitCodeThread(threads[i], &result);
+            CloseHandle(threads[i]);
+            if ( result ) failed = true;
+        #else
+            (void) pthread_join(threads[i], &p_result);
+            if ( p_result ) failed = true;
+        #endif
+    }
+
+    // Reclaim the nodes that were still protected when the updater exited
+    (void) hazptr_scan();
+
+    // Check the quantity of reclaimed nodes
+    if ( example.reclaimed != HAZARD_POINTER_EXAMPLE_UPDATES ) failed = true;
+
+    // Print the result
+    printf("%d readers read while %zu nodes were reclaimed %s\n", HAZARD_POINTER_EXAMPLE_READERS, example.reclaimed, failed ? "incorrectly" : "correctly");
+
+    // Free the last node
+    free(example.p_node);
+
+    // Format
+    putchar('\n');
+
+    // Success
+    return failed == false;
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_hazard_pointer_example_reader ( LPVOID p_parameter )
+#else
+void *sync_hazard_pointer_example_reader ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct hazard_pointer_example_s *p_example = p_parameter;
+
+    // Read the shared node, many times
+    for (size_t i = 0; i < HAZARD_POINTER_EXAMPLE_READS; i++)
+    {
+
+        // Initialized data
+        struct hazard_pointer_example_node_s *p_node = (void *) 0;
+        bool whole = false;
+
+        // Protect the node. It can't be reclaimed until the slot is cleared
+        p_node = hazptr_protect((void *const *) &p_example->p_node, 0);
+
+        // Error check
+        if ( p_node == (void *) 0 ) goto failed;
+
+        // Read the node
+        whole = ( p_node->a == p_node->b );
+
+        // Clear the hazard slot
+        if ( hazptr_clear(0) == 0 ) goto failed;
+
+        // Check the node
+        if ( whole == false ) goto failed;
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
 
     // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_hazard_pointer_example_updater ( LPVOID p_parameter )
+#else
+void *sync_hazard_pointer_example_updater ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct hazard_pointer_example_s *p_example = p_parameter;
+
+    // Replace the shared node, many times
+    for (size_t i = 1; i <= HAZARD_POINTER_EXAMPLE_UPDATES; i++)
     {
-        failed_to_run_timer_example:
 
-            // Write an error message to standard out
-            log_error("Error: Failed to run timer example!\n");
+        // Initialized data
+        struct hazard_pointer_example_node_s *p_node = calloc(1, sizeof(struct hazard_pointer_example_node_s)),
+                                             *p_old  = (void *) 0;
 
-            // Error
-            return EXIT_FAILURE;
+        // Error check
+        if ( p_node == (void *) 0 ) goto failed;
 
-        failed_to_run_mutex_example:
+        // Populate the node
+        p_node->a = i, p_node->b = i, p_node->p_example = p_example;
 
-            // Write an error message to standard out
-            log_error("Error: Failed to run mutex example!\n");
+        // Publish the node
+        p_old = __atomic_exchange_n(&p_example->p_node, p_node, __ATOMIC_ACQ_REL);
 
-            // Error
-            return EXIT_FAILURE;
-            
-        failed_to_run_spinlock_example:
+        // Retire the old node. It is reclaimed once no hazard slot protects it
+        if ( hazptr_retire(p_old, sync_hazard_pointer_example_reclaim) == 0 ) goto failed;
+    }
 
-            // Write an error message to standard out
-            log_error("Error: Failed to run spinlock example!\n");
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
 
-            // Error
-            return EXIT_FAILURE;
-        
-        failed_to_run_read_write_lock_example:
-        
-            // Write an error message to standard out
-            log_error("Error: Failed to run read write lock example!\n");
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
 
-            // Error
-            return EXIT_FAILURE;
-            
-        failed_to_run_semaphore_example:
+void sync_hazard_pointer_example_reclaim ( void *p_value )
+{
 
-            // Write an error message to standard out
-            log_error("Error: Failed to run semaphore example!\n");
+    // Initialized data
+    struct hazard_pointer_example_node_s *p_node = p_value;
 
-            // Error
-            return EXIT_FAILURE;
-        
-        failed_to_run_condition_variable_example:
-        
-            // Write an error message to standard out
-            log_error("Error: Failed to run condition variable example!\n");
+    // Count the node
+    __atomic_fetch_add(&p_node->p_example->reclaimed, 1, __ATOMIC_RELAXED);
 
-            // Error
-            return EXIT_FAILURE;
+    // Poison the node, so a reader that still held it would notice
+    p_node->a = 0, p_node->b = SIZE_MAX;
 
-        failed_to_run_monitor_example:
+    // Free the node
+    free(p_node);
 
-            // Write an error message to standard out
-            log_error("Error: Failed to run monitor example!\n");
+    // Done
+    return;
+}
 
-            // Error
-            return EXIT_FAILURE;
+int sync_weighted_semaphore_example ( int argc, const char *argv[] )
+{
 
-        failed_to_run_barrier_example:
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
 
-            // Write an error message to standard out
-            log_error("Error: Failed to run barrier example!\n");
+    // Initialized data
+    struct weighted_semaphore_example_s example = { 0 };
+    #ifdef _WIN64
+        HANDLE threads[WSEM_EXAMPLE_THREADS] = { 0 };
+    #else
+        pthread_t threads[WSEM_EXAMPLE_THREADS] = { 0 };
+        void *p_result = (void *) 0;
+    #endif
+    bool failed = false;
 
-            // Error
-            return EXIT_FAILURE;
+    // Formatting
+    log_info(
+        "╭────────────────────────────╮\n"\
+        "│ weighted semaphore example │\n"\
+        "╰────────────────────────────╯\n"\
+        "In this example, %d threads share a weighted semaphore with %d permits. The threads\n"\
+        "acquire 128, 256, 512 and 1024 permits at a time. Waiters are served in FIFO order, so\n"\
+        "the thread that needs every permit isn't starved by the others. Each thread checks that\n"\
+        "no more permits are in use than the semaphore holds\n\n",
+        WSEM_EXAMPLE_THREADS, WSEM_EXAMPLE_PERMITS
+    );
+
+    // Create
+    if ( wsem_create(&example.wsem, WSEM_EXAMPLE_PERMITS) == 0 ) return 0;
+
+    // Start the threads
+    for (size_t i = 0; i < WSEM_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_weighted_semaphore_example_thread, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_weighted_semaphore_example_thread, &example);
+        #endif
+    }
+
+    // Join the threads
+    for (size_t i = 0; i < WSEM_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            DWORD result = 0;
+            WaitForSingleObject(threads[i], INFINITE);
+            GetExitCodeThread(threads[i], &result);
+            CloseHandle(threads[i]);
+            if ( result ) failed = true;
+        #else
+            (void) pthread_join(threads[i], &p_result);
+            if ( p_result ) failed = true;
+        #endif
     }
+
+    // Check the permits
+    if ( example.overused ) failed = true;
+
+    // Print the result
+    printf("%d threads shared %d permits %s\n", WSEM_EXAMPLE_THREADS, WSEM_EXAMPLE_PERMITS, failed ? "incorrectly" : "correctly");
+
+    // Destroy
+    (void) wsem_destroy(&example.wsem);
+
+    // Format
+    putchar('\n');
+
+    // Success
+    return failed == false;
 }
 
-void print_usage ( const char *argv0 )
+#ifdef _WIN64
+DWORD WINAPI sync_weighted_semaphore_example_thread ( LPVOID p_parameter )
+#else
+void *sync_weighted_semaphore_example_thread ( void *p_parameter )
+#endif
 {
 
-    // Argument check
-    if ( argv0 == (void *) 0 ) exit(EXIT_FAILURE);
+    // Initialized data
+    struct weighted_semaphore_example_s *p_example = p_parameter;
+    uint64_t permits = (uint64_t) WSEM_EXAMPLE_PERMITS >> __atomic_fetch_add(&p_example->started, 1, __ATOMIC_RELAXED);
 
-    // Print a usage message to standard out
-    printf("Usage: %s [timer] [mutex] [spinlock] [read-write] [semaphore] [condition-variable] [monitor] [barrier]\n", argv0);
+    // Acquire permits, and release them, many times
+    for (size_t i = 0; i < WSEM_EXAMPLE_ITERATIONS; i++)
+    {
 
-    // Done
-    return;
+        // Acquire
+        if ( wsem_acquire(&p_example->wsem, permits) == 0 ) goto failed;
+
+        // Count the permits in use. There may never be more than the semaphore holds
+        if ( __atomic_add_fetch(&p_example->in_use, permits, __ATOMIC_RELAXED) > WSEM_EXAMPLE_PERMITS ) __atomic_fetch_add(&p_example->overused, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_sub(&p_example->in_use, permits, __ATOMIC_RELAXED);
+
+        // Release
+        if ( wsem_release(&p_example->wsem, permits) == 0 ) goto failed;
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
 }
 
-void parse_command_line_arguments ( int argc, const char *argv[], bool *examples_to_run )
+int sync_fast_condition_variable_example ( int argc, const char *argv[] )
 {
 
-    // If no command line arguments are supplied, run all the examples
-    if ( argc == 1 ) goto all_examples;
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
 
-    // Error check
-    if ( argc > SYNC_EXAMPLE_QUANTITY + 1 ) goto invalid_arguments;
+    // Initialized data
+    struct fast_condition_variable_example_s example = { 0 };
+    #ifdef _WIN64
+        HANDLE threads[FAST_CONDITION_VARIABLE_EXAMPLE_THREADS] = { 0 };
+    #else
+        pthread_t threads[FAST_CONDITION_VARIABLE_EXAMPLE_THREADS] = { 0 };
+        void *p_result = (void *) 0;
+    #endif
+    bool failed = false;
 
-    // Iterate through each command line argument
-    for (int i = 1; i < argc; i++)
+    // Formatting
+    log_info(
+        "╭─────────────────────────────────╮\n"\
+        "│ fast condition variable example │\n"\
+        "╰─────────────────────────────────╯\n"\
+        "In this example, %d threads meet %d times. The last thread to arrive starts the next round,\n"\
+        "and broadcasts on a fast condition variable. The broadcast wakes one waiter, and requeues\n"\
+        "the rest onto the fast mutex, so each unlock wakes the next waiter\n\n",
+        FAST_CONDITION_VARIABLE_EXAMPLE_THREADS, FAST_CONDITION_VARIABLE_EXAMPLE_ROUNDS
+    );
+
+    // Create
+    if ( fast_mutex_create(&example.mutex) == 0 ) return 0;
+    if ( fast_condition_variable_create(&example.condition) == 0 ) return 0;
+
+    // Start the threads
+    for (size_t i = 0; i < FAST_CONDITION_VARIABLE_EXAMPLE_THREADS; i++)
     {
-        
-        // Timer example?
-        if ( strcmp(argv[i], "timer") == 0 )
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_fast_condition_variable_example_thread, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_fast_condition_variable_example_thread, &example);
+        #endif
+    }
 
-            // Set the timer example flag
-            examples_to_run[SYNC_TIMER_EXAMPLE] = true;
+    // Join the threads
+    for (size_t i = 0; i < FAST_CONDITION_VARIABLE_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            DWORD result = 0;
+            WaitForSingleObject(threads[i], INFINITE);
+            GetExitCodeThread(threads[i], &result);
+            CloseHandle(threads[i]);
+            if ( result ) failed = true;
+        #else
+            (void) pthread_join(threads[i], &p_result);
+            if ( p_result ) failed = true;
+        #endif
+    }
 
-        // Mutex example?
-        else if ( strcmp(argv[i], "mutex") == 0 )
-            
-            // Set the mutex example flag
-            examples_to_run[SYNC_MUTEX_EXAMPLE] = true;
+    // Check the rounds
+    if ( example.round != FAST_CONDITION_VARIABLE_EXAMPLE_ROUNDS ) failed = true;
 
-        // Spinlock example?
-        else if ( strcmp(argv[i], "spinlock") == 0 )
-            
-            // Set the spinlock example flag
-            examples_to_run[SYNC_SPINLOCK_EXAMPLE] = true;
+    // Print the result
+    printf("%d threads met %zu times %s\n", FAST_CONDITION_VARIABLE_EXAMPLE_THREADS, example.round, failed ? "incorrectly" : "correctly");
 
-        // Read Write Lock example?
-        else if ( strcmp(argv[i], "read-write") == 0 )
-            
-            // Set the read write lock example flag
-            examples_to_run[SYNC_RW_LOCK_EXAMPLE] = true;
+    // Destroy
+    (void) fast_condition_variable_destroy(&example.condition);
+    (void) fast_mutex_destroy(&example.mutex);
 
-        // Semaphore example?
-        else if ( strcmp(argv[i], "semaphore") == 0 )
+    // Format
+    putchar('\n');
 
-            // Set the semaphore flag
-            examples_to_run[SYNC_SEMAPHORE_EXAMPLE] = true;
-        
-        // Monitor example?
-        else if ( strcmp(argv[i], "monitor") == 0 )
+    // Success
+    return failed == false;
+}
 
-            // Set the monitor flag
-            examples_to_run[SYNC_MONITOR_EXAMPLE] = true;
+#ifdef _WIN64
+DWORD WINAPI sync_fast_condition_variable_example_thread ( LPVOID p_parameter )
+#else
+void *sync_fast_condition_variable_example_thread ( void *p_parameter )
+#endif
+{
 
-        // Default
-        else goto invalid_arguments;
+    // Initialized data
+    struct fast_condition_variable_example_s *p_example = p_parameter;
+
+    // Meet the other threads, once per round
+    for (size_t i = 0; i < FAST_CONDITION_VARIABLE_EXAMPLE_ROUNDS; i++)
+    {
+
+        // Lock
+        if ( fast_mutex_lock(&p_example->mutex) == 0 ) goto failed;
+
+        // The last thread to arrive starts the next round, and wakes the others
+        if ( ++p_example->arrived == FAST_CONDITION_VARIABLE_EXAMPLE_THREADS )
+        {
+            p_example->arrived = 0;
+            p_example->round++;
+            (void) fast_condition_variable_broadcast(&p_example->condition);
+        }
+
+        // Every other thread waits for the next round
+        else
+        {
+
+            // Initialized data
+            size_t round = p_example->round;
+
+            // Wait, and absorb spurious wakeups
+            while ( round == p_example->round ) (void) fast_condition_variable_wait(&p_example->condition, &p_example->mutex);
+        }
+
+        // Unlock
+        if ( fast_mutex_unlock(&p_example->mutex) == 0 ) goto failed;
     }
-    
+
     // Success
-    return;
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
 
-    // Set each example flag
-    all_examples:
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+int sync_eventcount_example ( int argc, const char *argv[] )
+{
+
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    struct eventcount_example_s example = { 0 };
+    #ifdef _WIN64
+        HANDLE threads[EVENTCOUNT_EXAMPLE_PRODUCERS + EVENTCOUNT_EXAMPLE_CONSUMERS] = { 0 };
+    #else
+        pthread_t threads[EVENTCOUNT_EXAMPLE_PRODUCERS + EVENTCOUNT_EXAMPLE_CONSUMERS] = { 0 };
+        void *p_result = (void *) 0;
+    #endif
+    bool failed = false;
+
+    // Formatting
+    log_info(
+        "╭────────────────────╮\n"\
+        "│ eventcount example │\n"\
+        "╰────────────────────╯\n"\
+        "In this example, %d producers add items to a lock-free count, and %d consumers take them.\n"\
+        "A consumer that finds no items prepares to wait, checks again, and only then sleeps on the\n"\
+        "eventcount. A producer's notification costs a fence and a load while nobody is waiting\n\n",
+        EVENTCOUNT_EXAMPLE_PRODUCERS, EVENTCOUNT_EXAMPLE_CONSUMERS
+    );
+
+    // Create
+    if ( ec_create(&example.eventcount) == 0 ) return 0;
+
+    // Start the producers
+    for (size_t i = 0; i < EVENTCOUNT_EXAMPLE_PRODUCERS; i++)
     {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_eventcount_example_producer, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_eventcount_example_producer, &example);
+        #endif
+    }
 
-        // For each example ...
-        for (size_t i = 0; i < SYNC_EXAMPLE_QUANTITY; i++)
-        
-            // ... set the example flag
-            examples_to_run[i] = true;
-        
-        // Success
-        return;
+    // Start the consumers
+    for (size_t i = EVENTCOUNT_EXAMPLE_PRODUCERS; i < EVENTCOUNT_EXAMPLE_PRODUCERS + EVENTCOUNT_EXAMPLE_CONSUMERS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_eventcount_example_consumer, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_eventcount_example_consumer, &example);
+        #endif
+    }
+
+    // Join the threads
+    for (size_t i = 0; i < EVENTCOUNT_EXAMPLE_PRODUCERS + EVENTCOUNT_EXAMPLE_CONSUMERS; i++)
+    {
+        #ifdef _WIN64
+            DWORD result = 0;
+            WaitForSingleObject(threads[i], INFINITE);
+            GetExitCodeThread(threads[i], &result);
+            CloseHandle(threads[i]);
+            if ( result ) failed = true;
+        #else
+            (void) pthread_join(threads[i], &p_result);
+            if ( p_result ) failed = true;
+        #endif
+    }
+
+    // Check the quantity of consumed items
+    if ( example.consumed != EVENTCOUNT_EXAMPLE_PRODUCERS * EVENTCOUNT_EXAMPLE_ITEMS || example.items ) failed = true;
+
+    // Print the result
+    printf("%d consumers took %zu items %s\n", EVENTCOUNT_EXAMPLE_CONSUMERS, example.consumed, failed ? "incorrectly" : "correctly");
+
+    // Destroy
+    (void) ec_destroy(&example.eventcount);
+
+    // Format
+    putchar('\n');
+
+    // Success
+    return failed == false;
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_eventcount_example_producer ( LPVOID p_parameter )
+#else
+void *sync_eventcount_example_producer ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct eventcount_example_s *p_example = p_parameter;
+
+    // Add items
+    for (size_t i = 0; i < EVENTCOUNT_EXAMPLE_ITEMS; i++)
+    {
+
+        // Add an item
+        __atomic_fetch_add(&p_example->items, 1, __ATOMIC_SEQ_CST);
+
+        // Wake a consumer, if any are waiting
+        if ( ec_notify(&p_example->eventcount) == 0 ) goto failed;
     }
 
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
     // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+#ifdef _WIN64
+DWORD WINAPI sync_eventcount_example_consumer ( LPVOID p_parameter )
+#else
+void *sync_eventcount_example_consumer ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct eventcount_example_s *p_example = p_parameter;
+
+    // Take this consumer's share of the items
+    for (size_t i = 0; i < EVENTCOUNT_EXAMPLE_PRODUCERS * EVENTCOUNT_EXAMPLE_ITEMS / EVENTCOUNT_EXAMPLE_CONSUMERS; i++)
     {
 
-        // Argument errors
+        // Take an item, waiting while there are none
+        while ( sync_eventcount_example_take(p_example) == false )
         {
-            invalid_arguments:
-                
-                // Print a usage message to standard out
-                print_usage(argv[0]);
 
-                // Abort
-                exit(EXIT_FAILURE);
-        }
-    }
+            // Initialized data
+            uint32_t key = ec_prepare_wait(&p_example->eventcount);
+
+            // Check again, in case an item arrived before the caller prepared to wait
+            if ( sync_eventcount_example_take(p_example) )
+            {
+                (void) ec_cancel_wait(&p_example->eventcount);
+                break;
+            }
+
+            // Sleep until a producer notifies the eventcount
+            if ( ec_wait(&p_example->eventcount, key) == 0 ) goto failed;
+        }
+
+        // Count the item
+        __atomic_fetch_add(&p_example->consumed, 1, __ATOMIC_RELAXED);
+    }
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+bool sync_eventcount_example_take ( struct eventcount_example_s *p_example )
+{
+
+    // Initialized data
+    size_t items = __atomic_load_n(&p_example->items, __ATOMIC_SEQ_CST);
+
+    // Take an item, unless there are none
+    while ( items )
+        if ( __atomic_compare_exchange_n(&p_example->items, &items, items - 1, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ) return true;
+
+    // Done
+    return false;
 }
 
-int sync_timer_example ( int argc, const char *argv[] )
+int sync_phaser_example ( int argc, const char *argv[] )
 {
 
     // Suppress warnings
@@ -395,147 +4157,188 @@ int sync_timer_example ( int argc, const char *argv[] )
     (void) argv;
 
     // Initialized data
-    size_t    c   = 0,
-              d   = 1;
-    double    sec = 0;
-    timestamp t1  = 0, 
-              t2  = 0,
-              td  = 0;
+    struct phaser_example_s example = { 0 };
+    #ifdef _WIN64
+        HANDLE threads[PHASER_EXAMPLE_PARTIES + PHASER_EXAMPLE_TRANSIENTS] = { 0 };
+    #else
+        pthread_t threads[PHASER_EXAMPLE_PARTIES + PHASER_EXAMPLE_TRANSIENTS] = { 0 };
+        void *p_result = (void *) 0;
+    #endif
+    bool failed = false;
 
     // Formatting
     log_info(
-        "╭───────────────╮\n"\
-        "│ timer example │\n"\
-        "╰───────────────╯\n"\
-        "In this example, the timer is initialized. The program samples a timestamp t0,\n"\
-        "computes the 1,000,000,000th fibonacci number, and samples another timestamp t1.\n"\
-        "The difference of the timestamps (t1 - t0) is printed to standard out.\n\n"
+        "╭────────────────╮\n"\
+        "│ phaser example │\n"\
+        "╰────────────────╯\n"\
+        "In this example, %d parties meet %d times, spread over %d tiers of a root phaser. The last\n"\
+        "party to arrive at a tier arrives at the root for the whole tier. Meanwhile, %d transient\n"\
+        "parties join a tier, stay for %d phases, and leave again. Each party checks that every other\n"\
+        "party arrived before the phase ended\n\n",
+        PHASER_EXAMPLE_PARTIES, PHASER_EXAMPLE_PHASES, PHASER_EXAMPLE_TIERS, PHASER_EXAMPLE_TRANSIENTS, PHASER_EXAMPLE_STAY
     );
 
-    // Record a timestamp
-    t1 = timer_high_precision();
+    // Create the root
+    if ( phaser_create(&example.root, (void *) 0, 0) == 0 ) return 0;
 
-    // Iteratively calculate fib(NTH_FIBONACCI_NUMBER) 
-    for (size_t i = 0; i < NTH_FIBONACCI_NUMBER; i++)
+    // Create the tiers. Party i arrives at tier i % PHASER_EXAMPLE_TIERS
+    for (size_t i = 0; i < PHASER_EXAMPLE_TIERS; i++)
+        if ( phaser_create(&example.tiers[i], &example.root, (unsigned int) ( ( PHASER_EXAMPLE_PARTIES - i + PHASER_EXAMPLE_TIERS - 1 ) / PHASER_EXAMPLE_TIERS )) == 0 ) return 0;
+
+    // Start the parties
+    for (size_t i = 0; i < PHASER_EXAMPLE_PARTIES; i++)
     {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_phaser_example_party, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_phaser_example_party, &example);
+        #endif
+    }
 
-        // Initialized data
-        size_t e = c + d;
+    // Start the transient parties
+    for (size_t i = PHASER_EXAMPLE_PARTIES; i < PHASER_EXAMPLE_PARTIES + PHASER_EXAMPLE_TRANSIENTS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_phaser_example_transient, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_phaser_example_transient, &example);
+        #endif
+    }
 
-        // Iteration
-        c = d, d = e;
+    // Join the threads
+    for (size_t i = 0; i < PHASER_EXAMPLE_PARTIES + PHASER_EXAMPLE_TRANSIENTS; i++)
+    {
+        #ifdef _WIN64
+            DWORD result = 0;
+            WaitForSingleObject(threads[i], INFINITE);
+            GetExitCodeThread(threads[i], &result);
+            CloseHandle(threads[i]);
+            if ( result ) failed = true;
+        #else
+            (void) pthread_join(threads[i], &p_result);
+            if ( p_result ) failed = true;
+        #endif
     }
-    
-    // Record another timestamp
-    t2 = timer_high_precision();
 
-    // Compute the difference
-    td = t2 - t1;
+    // Check for parties that ended a phase early
+    if ( example.early ) failed = true;
 
-    // Convert the difference to seconds
-    sec = (double) td / (double) ( timer_seconds_divisor() );
+    // Print the result
+    printf("%d parties, and %zu joins, across %d tiers, %s\n", PHASER_EXAMPLE_PARTIES, example.joined, PHASER_EXAMPLE_TIERS, failed ? "incorrectly" : "correctly");
 
-    // Print the time difference in seconds
-    (void)printf("%zu\r[sync] [timer] It took %lf seconds to calculate fib(%d)\n", d, sec, NTH_FIBONACCI_NUMBER);
+    // Destroy
+    for (size_t i = 0; i < PHASER_EXAMPLE_TIERS; i++) (void) phaser_destroy(&example.tiers[i]);
+    (void) phaser_destroy(&example.root);
 
     // Format
     putchar('\n');
 
     // Success
-    return 1;
+    return failed == false;
 }
 
-int sync_mutex_example ( int argc, const char *argv[] )
+#ifdef _WIN64
+DWORD WINAPI sync_phaser_example_party ( LPVOID p_parameter )
+#else
+void *sync_phaser_example_party ( void *p_parameter )
+#endif
 {
 
-    // Suppress warnings
-    (void) argc;
-    (void) argv;
-
     // Initialized data
-    mutex m = { 0 };
-
-    // Formatting
-    log_info(
-        "╭───────────────╮\n"\
-        "│ mutex example │\n"\
-        "╰───────────────╯\n"\
-        "In this example, a mutex is created and locked. The program does a pretend\n"\
-        "critical section, then the mutex is unlocked. Finally, the mutex is destroyed\n\n"
-    );
+    struct phaser_example_s *p_example = p_parameter;
+    size_t party = __atomic_fetch_add(&p_example->started, 1, __ATOMIC_RELAXED);
+    phaser *p_tier = &p_example->tiers[party % PHASER_EXAMPLE_TIERS];
+    uint32_t token = 0;
 
-    // Create
-    if ( mutex_create(&m) == 0 ) return EXIT_FAILURE;
+    // Meet the other parties, once per phase
+    for (size_t i = 1; i <= PHASER_EXAMPLE_PHASES; i++)
+    {
 
-    // Lock
-    printf("[WAIT] Locking mutex ... \r");
-    (void) mutex_lock(&m);
-    log_info("[DONE]\n");
+        // Record the progress of this party
+        __atomic_store_n(&p_example->progress[party], i, __ATOMIC_RELEASE);
 
-    // ... (Pretend) critical section ...
-    printf("This message was printed from a critical section\n");
+        // Arrive, and wait for the other parties
+        if ( phaser_arrive_and_wait(p_tier) == 0 ) goto failed;
 
-    // Unlock
-    printf("[WAIT] Unlocking mutex ... \r");
-    (void) mutex_unlock(&m);
-    log_info("[DONE]\n");
+        // Every party arrived before the phase ended
+        for (size_t j = 0; j < PHASER_EXAMPLE_PARTIES; j++)
+            if ( __atomic_load_n(&p_example->progress[j], __ATOMIC_ACQUIRE) < i ) __atomic_fetch_add(&p_example->early, 1, __ATOMIC_RELAXED);
+    }
 
-    // Destroy
-    (void) mutex_destroy(&m);
+    // Leave
+    if ( phaser_arrive_and_deregister(p_tier, &token) == 0 ) goto failed;
 
-    // Format
-    putchar('\n');
+    // Count the party as finished
+    __atomic_fetch_add(&p_example->finished, 1, __ATOMIC_RELEASE);
 
     // Success
-    return 1;
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
 }
 
-int sync_spinlock_example ( int argc, const char *argv[] )
+#ifdef _WIN64
+DWORD WINAPI sync_phaser_example_transient ( LPVOID p_parameter )
+#else
+void *sync_phaser_example_transient ( void *p_parameter )
+#endif
 {
 
-    // Suppress warnings
-    (void) argc;
-    (void) argv;
-
     // Initialized data
-    spinlock sl = { 0 };
-
-    // Formatting
-    log_info(
-        "╭──────────────────╮\n"\
-        "│ spinlock example │\n"\
-        "╰──────────────────╯\n"\
-        "In this example, a spinlock is created and locked. The program does a pretend\n"\
-        "critical section, then the spinlock is unlocked. Finally, the spinlock is destroyed\n\n"
-    );
+    struct phaser_example_s *p_example = p_parameter;
 
-    // Create
-    if ( spinlock_create(&sl) == 0 ) return EXIT_FAILURE;
+    // Join and leave tiers, until every other party has finished
+    for (size_t i = 0; __atomic_load_n(&p_example->finished, __ATOMIC_ACQUIRE) < PHASER_EXAMPLE_PARTIES; i++)
+    {
 
-    // Lock
-    printf("[WAIT] Locking spinlock ... \r");
-    spinlock_lock(&sl);
-    log_info("[DONE]\n");
+        // Initialized data
+        phaser *p_tier = &p_example->tiers[i % PHASER_EXAMPLE_TIERS];
+        uint32_t token = 0;
 
-    // ... (Pretend) critical section ...
-    printf("This message was printed from a critical section\n");
+        // Join
+        if ( phaser_register(p_tier) == 0 ) goto failed;
 
-    // Unlock
-    printf("[WAIT] Unlocking spinlock ... \r");
-    (void) spinlock_unlock(&sl);
-    log_info("[DONE]\n");
+        // Count the join
+        __atomic_fetch_add(&p_example->joined, 1, __ATOMIC_RELAXED);
 
-    // Destroy
-    (void) spinlock_destroy(&sl);
+        // Stay for a few phases. Arrive, and then wait for the phase to end
+        for (size_t j = 0; j < PHASER_EXAMPLE_STAY; j++)
+        {
+            if ( phaser_arrive(p_tier, &token) == 0 ) goto failed;
+            if ( phaser_wait_token(p_tier, token) == 0 ) goto failed;
+        }
 
-    // Format
-    putchar('\n');
+        // Leave
+        if ( phaser_arrive_and_deregister(p_tier, &token) == 0 ) goto failed;
+    }
 
     // Success
-    return 1;
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
 }
 
-int sync_read_write_lock_example ( int argc, const char *argv[] )
+int sync_latch_example ( int argc, const char *argv[] )
 {
 
     // Suppress warnings
@@ -543,43 +4346,120 @@ int sync_read_write_lock_example ( int argc, const char *argv[] )
     (void) argv;
 
     // Initialized data
-    rwlock rw = { 0 };
+    struct latch_example_s example = { 0 };
+    #ifdef _WIN64
+        HANDLE threads[LATCH_EXAMPLE_THREADS] = { 0 };
+    #else
+        pthread_t threads[LATCH_EXAMPLE_THREADS] = { 0 };
+        void *p_result = (void *) 0;
+    #endif
+    bool failed = false;
 
     // Formatting
     log_info(
-        "╭─────────────────────────╮\n"\
-        "│ read write lock example │\n"\
-        "╰─────────────────────────╯\n"\
-        "In this example, a read write lock is created. [TODO] Finally, the read write lock is destroyed\n\n"
+        "╭───────────────╮\n"\
+        "│ latch example │\n"\
+        "╰───────────────╯\n"\
+        "In this example, %d threads wait on a start latch, until the main thread opens it. Each thread\n"\
+        "adds 1 to a counter %d times, then counts down a done latch. The main thread waits on the\n"\
+        "done latch, and checks the counter before joining the threads\n\n",
+        LATCH_EXAMPLE_THREADS, LATCH_EXAMPLE_ITERATIONS
     );
 
-    // Create
-    if ( rwlock_create(&rw) ) return EXIT_FAILURE;
+    // Create the start latch. The main thread opens it
+    if ( latch_create(&example.start, 1) == 0 ) return 0;
 
-    // Lock
-    printf("[WAIT] Locking read write lock ... \r");
-    rwlock_lock_wr(&rw);
-    log_info("[DONE]\n");
+    // Create the done latch. Each thread counts it down once
+    if ( latch_create(&example.done, 0) == 0 ) return 0;
 
-    // ... (Pretend) critical section ...
-    printf("This message was printed from a critical section\n");
+    // Count the threads before they start
+    if ( latch_add(&example.done, LATCH_EXAMPLE_THREADS) == 0 ) return 0;
 
-    // Unlock
-    printf("[WAIT] Unlocking read write lock ... \r");
-    rwlock_unlock(&rw);
-    log_info("[DONE]\n");
+    // Start the threads
+    for (size_t i = 0; i < LATCH_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_latch_example_thread, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_latch_example_thread, &example);
+        #endif
+    }
+
+    // Open the start latch
+    if ( latch_count_down(&example.start, 1) == 0 ) failed = true;
+
+    // Wait for every thread to finish
+    if ( latch_wait(&example.done) == 0 ) failed = true;
+
+    // Check the counter, before joining the threads
+    if ( __atomic_load_n(&example.count, __ATOMIC_RELAXED) != LATCH_EXAMPLE_THREADS * LATCH_EXAMPLE_ITERATIONS ) failed = true;
+
+    // Join the threads
+    for (size_t i = 0; i < LATCH_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            DWORD result = 0;
+            WaitForSingleObject(threads[i], INFINITE);
+            GetExitCodeThread(threads[i], &result);
+            CloseHandle(threads[i]);
+            if ( result ) failed = true;
+        #else
+            (void) pthread_join(threads[i], &p_result);
+            if ( p_result ) failed = true;
+        #endif
+    }
+
+    // Print the result
+    printf("%d threads counted to %zu %s\n", LATCH_EXAMPLE_THREADS, example.count, failed ? "incorrectly" : "correctly");
 
     // Destroy
-    (void) rwlock_destroy(&rw);
+    (void) latch_destroy(&example.done);
+    (void) latch_destroy(&example.start);
 
     // Format
     putchar('\n');
 
     // Success
-    return 1;
+    return failed == false;
 }
 
-int sync_semaphore_example ( int argc, const char *argv[] )
+#ifdef _WIN64
+DWORD WINAPI sync_latch_example_thread ( LPVOID p_parameter )
+#else
+void *sync_latch_example_thread ( void *p_parameter )
+#endif
+{
+
+    // Initialized data
+    struct latch_example_s *p_example = p_parameter;
+
+    // Wait for the start latch
+    if ( latch_wait(&p_example->start) == 0 ) goto failed;
+
+    // Add 1 to the counter, many times
+    for (size_t i = 0; i < LATCH_EXAMPLE_ITERATIONS; i++)
+        __atomic_fetch_add(&p_example->count, 1, __ATOMIC_RELAXED);
+
+    // Count down the done latch
+    if ( latch_count_down(&p_example->done, 1) == 0 ) goto failed;
+
+    // Success
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
+}
+
+int sync_once_example ( int argc, const char *argv[] )
 {
 
     // Suppress warnings
@@ -587,102 +4467,113 @@ int sync_semaphore_example ( int argc, const char *argv[] )
     (void) argv;
 
     // Initialized data
-    semaphore s = { 0 };
-    
+    struct once_example_s example = { .flag = SYNC_ONCE_INIT };
+    #ifdef _WIN64
+        HANDLE threads[ONCE_EXAMPLE_THREADS] = { 0 };
+    #else
+        pthread_t threads[ONCE_EXAMPLE_THREADS] = { 0 };
+        void *p_result = (void *) 0;
+    #endif
+    bool failed = false;
+
     // Formatting
     log_info(
-        "╭───────────────────╮\n"\
-        "│ semaphore example │\n"\
-        "╰───────────────────╯\n"\
-        "In this example, a semaphore is created and locked. The program does a pretend\n"\
-        "critical section, then the semaphore is unlocked. Finally, the semaphore is destroyed\n\n"
+        "╭──────────────╮\n"\
+        "│ once example │\n"\
+        "╰──────────────╯\n"\
+        "In this example, %d threads call an initializer through the same once flag. The first\n"\
+        "thread runs it, and the others wait for it to return. Each thread checks that the value is\n"\
+        "initialized\n\n",
+        ONCE_EXAMPLE_THREADS
     );
 
-    // Create
-    if ( semaphore_create(&s, 1) == 0 ) return EXIT_FAILURE;
-    
-    // Wait
-    (void) semaphore_wait(s);
+    // Start the threads
+    for (size_t i = 0; i < ONCE_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            threads[i] = CreateThread(NULL, 0, sync_once_example_thread, &example, 0, NULL);
+        #else
+            (void) pthread_create(&threads[i], NULL, sync_once_example_thread, &example);
+        #endif
+    }
 
-    // ... (Pretend) critical section ...
-    printf("This message was printed from a critical section\n");
+    // Join the threads
+    for (size_t i = 0; i < ONCE_EXAMPLE_THREADS; i++)
+    {
+        #ifdef _WIN64
+            DWORD result = 0;
+            WaitForSingleObject(threads[i], INFINITE);
+            GetExitCodeThread(threads[i], &result);
+            CloseHandle(threads[i]);
+            if ( result ) failed = true;
+        #else
+            (void) pthread_join(threads[i], &p_result);
+            if ( p_result ) failed = true;
+        #endif
+    }
 
-    // Signal
-    (void) semaphore_signal(s);
+    // Check that the initializer ran once, and that every thread saw the value
+    if ( example.runs != 1 || example.seen != ONCE_EXAMPLE_THREADS ) failed = true;
 
-    // Destroy
-    (void) semaphore_destroy(&s);
+    // Print the result
+    printf("%d threads ran the initializer %zu time%s %s\n", ONCE_EXAMPLE_THREADS, example.runs, example.runs == 1 ? "" : "s", failed ? "incorrectly" : "correctly");
 
     // Format
     putchar('\n');
 
     // Success
-    return 1;
+    return failed == false;
 }
 
-int sync_condition_variable_example ( int argc, const char *argv[] )
+#ifdef _WIN64
+DWORD WINAPI sync_once_example_thread ( LPVOID p_parameter )
+#else
+void *sync_once_example_thread ( void *p_parameter )
+#endif
 {
 
-    // Suppress warnings
-    (void) argc;
-    (void) argv;
-
     // Initialized data
-    condition_variable c = { 0 };
-    
-    // Formatting
-    log_info(
-        "╭────────────────────────────╮\n"\
-        "│ condition variable example │\n"\
-        "╰────────────────────────────╯\n"\
-        "TODO\n\n"
-    );
-
-    // Create
-    if ( condition_variable_create(&c) == 0 ) return EXIT_FAILURE;
+    struct once_example_s *p_example = p_parameter;
 
-    // TODO
-    // 
+    // Initialize the value
+    if ( sync_once(&p_example->flag, sync_once_example_init, p_example) == 0 ) goto failed;
 
-    // Destroy
-    (void) condition_variable_destroy(&c);
+    // Check the value. Plain reads are safe after sync_once returns
+    if ( p_example->value == ONCE_EXAMPLE_VALUE ) __atomic_fetch_add(&p_example->seen, 1, __ATOMIC_RELAXED);
 
     // Success
-    return 1;
+    #ifdef _WIN64
+        return 0;
+    #else
+        return (void *) 0;
+    #endif
+
+    // Error handling
+    failed:
+        #ifdef _WIN64
+            return 1;
+        #else
+            return (void *) 1;
+        #endif
 }
 
-int sync_monitor_example ( int argc, const char *argv[] )
+void sync_once_example_init ( void *p_parameter )
 {
 
-    // Suppress warnings
-    (void) argc;
-    (void) argv;
-
     // Initialized data
-    monitor m = { 0 };
-    
-    // Formatting
-    log_info(
-        "╭─────────────────╮\n"\
-        "│ monitor example │\n"\
-        "╰─────────────────╯\n"\
-        "TODO\n\n"
-    );
-
-    // Create
-    if ( monitor_create(&m) == 0 ) return EXIT_FAILURE;
+    struct once_example_s *p_example = p_parameter;
 
-    // TODO
-    //
+    // Count the run
+    p_example->runs++;
 
-    // Destroy
-    (void) monitor_destroy(&m);
+    // Set the value
+    p_example->value = ONCE_EXAMPLE_VALUE;
 
-    // Success
-    return 1;
+    // Done
+    return;
 }
 
-int sync_barrier_example ( int argc, const char *argv[] )
+int sync_pool_example ( int argc, const char *argv[] )
 {
 
     // Suppress warnings
@@ -690,27 +4581,84 @@ int sync_barrier_example ( int argc, const char *argv[] )
     (void) argv;
 
     // Initialized data
-    barrier b = { 0 };
-    
+    struct pool_example_s example = { 0 };
+    bool failed = false;
+
     // Formatting
     log_info(
-        "╭─────────────────╮\n"\
-        "│ barrier example │\n"\
-        "╰─────────────────╯\n"\
-        "TODO\n\n"
+        "╭──────────────╮\n"\
+        "│ pool example │\n"\
+        "╰──────────────╯\n"\
+        "In this example, a root task submits two child tasks, and each child submits two more, until\nthe tree is %d levels deep. The tasks run on a pool with one worker per processor. The main\nthread waits for every task, and checks that each one ran\n\n",
+        POOL_EXAMPLE_DEPTH + 1
     );
 
-    // Create
-    if ( barrier_create(&b, 0) == 0 ) return EXIT_FAILURE;
+    // Allocate a parameter for each task. Task i submits tasks 2i+1 and 2i+2
+    example.p_tasks = calloc(POOL_EXAMPLE_TASKS, sizeof(struct pool_example_task_s));
+    if ( example.p_tasks == (void *) 0 ) return 0;
+
+    // Populate the parameters
+    for (size_t i = 0; i < POOL_EXAMPLE_TASKS; i++)
+        example.p_tasks[i] = (struct pool_example_task_s) { .p_example = &example, .index = i };
+
+    // Create a pool with one worker per processor
+    if ( sync_pool_create(&example.p_pool, 0) == 0 ) goto failed_to_create_pool;
+
+    // Submit the root task
+    if ( sync_pool_submit(example.p_pool, sync_pool_example_task, &example.p_tasks[0]) == 0 ) failed = true;
+
+    // Wait for the root task, and every task it submits
+    if ( sync_pool_wait(example.p_pool) == 0 ) failed = true;
 
-    // TODO: 
+    // Check the counter
+    if ( example.errors || example.count != POOL_EXAMPLE_TASKS ) failed = true;
+
+    // Print the result
+    printf("%zu nested tasks ran %s\n", example.count, failed ? "incorrectly" : "correctly");
 
     // Destroy
-    (void) barrier_destroy(&b);
+    (void) sync_pool_destroy(&example.p_pool);
+
+    // Free the parameters
+    free(example.p_tasks);
 
     // Format
     putchar('\n');
-    
+
     // Success
-    return 1;
+    return failed == false;
+
+    // Error handling
+    {
+        failed_to_create_pool:
+
+            // Free the parameters
+            free(example.p_tasks);
+
+            // Error
+            return 0;
+    }
+}
+
+void sync_pool_example_task ( void *p_parameter )
+{
+
+    // Initialized data
+    struct pool_example_task_s *p_task = p_parameter;
+    struct pool_example_s *p_example = p_task->p_example;
+    size_t left = 2 * p_task->index + 1;
+
+    // Count the task
+    __atomic_fetch_add(&p_example->count, 1, __ATOMIC_RELAXED);
+
+    // Leaf?
+    if ( left >= POOL_EXAMPLE_TASKS ) return;
+
+    // Submit the children
+    for (size_t i = left; i <= left + 1; i++)
+        if ( sync_pool_submit(p_example->p_pool, sync_pool_example_task, &p_example->p_tasks[i]) == 0 )
+            __atomic_fetch_add(&p_example->errors, 1, __ATOMIC_RELAXED);
+
+    // Done
+    return;
 }
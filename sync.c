@@ -6,741 +6,7872 @@
  * @author Jacob Smith
  */
 
+// Feature test macros
+#define _GNU_SOURCE
+
+// Standard library
+#include <stdlib.h>
+#include <string.h>
+
 // Header file 
 #include <sync/sync.h>
 
-// Preprocessor macros
-#define SEC_2_NS 1000000000
-
-// Data
-static signed SYNC_TIMER_DIVISOR = 0;
-static bool initialized = false;
+// Dependency check
+#if defined(BUILD_SYNC_WITH_TRACE) && !defined(BUILD_SYNC_WITH_TIMER)
+    #error "BUILD_SYNC_WITH_TRACE requires BUILD_SYNC_WITH_TIMER"
+#endif
 
-void sync_init ( void ) 
-{
+#if defined(BUILD_SYNC_WITH_STATS) && !defined(BUILD_SYNC_WITH_TIMER)
+    #error "BUILD_SYNC_WITH_STATS requires BUILD_SYNC_WITH_TIMER"
+#endif
 
-    // State check
-    if ( initialized == true ) return;
+#if defined(BUILD_SYNC_WITH_MONITOR) && !( defined(BUILD_SYNC_WITH_MUTEX) && defined(BUILD_SYNC_WITH_CONDITION_VARIABLE) )
+    #error "BUILD_SYNC_WITH_MONITOR requires BUILD_SYNC_WITH_MUTEX and BUILD_SYNC_WITH_CONDITION_VARIABLE"
+#endif
 
-    // Initialize the log library
-    log_init();
+#if defined(BUILD_SYNC_WITH_POOL) && !( defined(BUILD_SYNC_WITH_EVENTCOUNT) && defined(BUILD_SYNC_WITH_LATCH) )
+    #error "BUILD_SYNC_WITH_POOL requires BUILD_SYNC_WITH_EVENTCOUNT and BUILD_SYNC_WITH_LATCH"
+#endif
 
-    // Platform dependent implementation
-    #ifdef _WIN64
-        QueryPerformanceFrequency((LARGE_INTEGER *)&SYNC_TIMER_DIVISOR);
-    #else
+// Platform dependent includes
+#ifndef _WIN64
+    #include <sched.h>
+    #include <sys/syscall.h>
+#endif
 
-        // Update the timer divisor
-        *(signed *)(&SYNC_TIMER_DIVISOR) = SEC_2_NS;
-    #endif
+#ifdef __linux__
+    #include <dirent.h>
+    #include <limits.h>
+    #include <linux/futex.h>
+    #include <linux/membarrier.h>
+#endif
 
-    // Set the initialized flag
-    initialized = true;
+#if !defined(_WIN64) && ( defined(__x86_64__) || defined(__i386__) )
+    #include <cpuid.h>
+    #include <x86intrin.h>
 
-    // Done
-    return;
-}
+    // Use the time stamp counter
+    #define SYNC_TIMER_TSC
+#endif
 
-#ifdef BUILD_SYNC_WITH_MUTEX
-int mutex_create ( mutex *p_mutex )
-{
+#if defined(BUILD_SYNC_WITH_TIMER) && defined(SYNC_TIMER_TSC) && !defined(BUILD_SYNC_WITH_ONCE)
+    #error "BUILD_SYNC_WITH_TIMER requires BUILD_SYNC_WITH_ONCE on x86"
+#endif
 
-    // Argument check
-    if ( p_mutex == (void *) 0 ) goto no_mutex;
+// Preprocessor macros
+#define SEC_2_NS 1000000000
+#define SYNC_TIMER_CALIBRATION_NS 5000000
+#define SYNC_TIMER_TSC_MAX_SKEW_NS 2000
+#define SYNC_TIMER_TSC_SAMPLES 4
+#define SYNC_HISTOGRAM_SHARDS 16
+#define SYNC_HISTOGRAM_SUB_BUCKET_BITS 5
+#define SYNC_HISTOGRAM_SUB_BUCKETS ( 1 << SYNC_HISTOGRAM_SUB_BUCKET_BITS )
+#define SYNC_HISTOGRAM_BUCKETS ( ( 64 - SYNC_HISTOGRAM_SUB_BUCKET_BITS + 1 ) * SYNC_HISTOGRAM_SUB_BUCKETS )
+#define SYNC_CACHE_LINE 64
+#define SYNC_ADAPTIVE_MAX_SPIN_NS 50000
+#define SYNC_ADAPTIVE_SAMPLE_PERIOD 16
+#define SYNC_SPIN_YIELD 1024
+#define SYNC_BACKOFF_MAX 1024
+#define SYNC_RCU_BATCH 64
+#define SYNC_HAZPTR_SCAN_MIN 64
+#define SYNC_RWLOCK_READ 0
+#define SYNC_RWLOCK_WRITE 1
+#define SYNC_RWLOCK_UPGRADABLE 2
+#define SYNC_RWLOCK_CLOSED 0x80000000U
+#define SYNC_RWLOCK_READERS 0x7fffffffU
+#define SYNC_SEMAPHORE_SPIN 128
+#define SYNC_EVENTCOUNT_EPOCH ( (uint64_t) 1 << 32 )
+#define SYNC_BARRIER_FAN_IN 4
+#define SYNC_BARRIER_SPIN 4096
+#define SYNC_LATCH_SPIN 128
+#define SYNC_ONCE_RUNNING 1
+#define SYNC_ONCE_WAITERS 2
+#define SYNC_POOL_DEQUE 256
+#define SYNC_POOL_INJECT 64
+#define SYNC_POOL_SPIN 64
+#define SYNC_POOL_MAX_PROCESSORS 1024
+#define SYNC_PHASER_UNARRIVED ( (uint64_t) 1 )
+#define SYNC_PHASER_PARTY ( (uint64_t) 1 << 16 )
+#define SYNC_PHASER_STATE(phase, parties, unarrived) ( ( (uint64_t) (phase) << 32 ) | ( (uint64_t) (parties) << 16 ) | (uint64_t) (unarrived) )
+#define SYNC_PHASER_GET_PHASE(state) ( (uint32_t) ( (state) >> 32 ) )
+#define SYNC_PHASER_GET_PARTIES(state) ( (uint32_t) ( ( (state) >> 16 ) & 0xffff ) )
+#define SYNC_PHASER_GET_UNARRIVED(state) ( (uint32_t) ( (state) & 0xffff ) )
+
+// The epoch half of an eventcount, which is the futex word
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    #define SYNC_EVENTCOUNT_FUTEX(p_eventcount) ( (uint32_t *)&(p_eventcount)->_state + 1 )
+#else
+    #define SYNC_EVENTCOUNT_FUTEX(p_eventcount) ( (uint32_t *)&(p_eventcount)->_state )
+#endif
 
-    // Platform dependent implementation
-    #ifdef _WIN64
+// The phase half of a phaser, which is the futex word
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    #define SYNC_PHASER_FUTEX(p_phaser) ( (uint32_t *)&(p_phaser)->_state + 1 )
+#else
+    #define SYNC_PHASER_FUTEX(p_phaser) ( (uint32_t *)&(p_phaser)->_state )
+#endif
 
-        // Create a mutex
-        *p_mutex = CreateMutex(0, FALSE, 0);
+// The native object inside a primitive. With stats, primitives wrap the native object
+#if defined(BUILD_SYNC_WITH_STATS) && !defined(_WIN64)
+    #define SYNC_NATIVE(p_object, _native) ( &(p_object)->_native )
+#else
+    #define SYNC_NATIVE(p_object, _native) ( p_object )
+#endif
 
-        // Return
-        return ( *p_mutex != 0 );
-    #else
+// Lock a primitive, and record how long the lock took
+#define SYNC_STATS_LOCK(p_object, ret, try_lock, lock)                                                      \
+    do                                                                                                     \
+    {                                                                                                      \
+        timestamp _start = 0;                                                                              \
+        if ( (try_lock) == 0 ) ret = 1, sync_stats_acquire(&(p_object)->_stats, false, 0);                 \
+        else if ( _start = timer_high_precision(), ret = ( (lock) == 0 ), ret )                            \
+            sync_stats_acquire(&(p_object)->_stats, true, timer_high_precision() - _start);                \
+    } while ( 0 )
+
+#ifndef SYNC_TRACE_RING_SIZE
+    #define SYNC_TRACE_RING_SIZE 16384
+#endif
 
-        // Return
-        return ( pthread_mutex_init(p_mutex, NULL) == 0 );
-    #endif
+// Data
+static timestamp SYNC_TIMER_DIVISOR = 0;
+static bool initialized = false;
+static long sync_processors = 1;
+static size_t sync_threads = 0;
+static __thread size_t sync_thread = SIZE_MAX;
 
-    // Error handling
-    {
-        
-        // Argument errors
-        {
-            no_mutex:
-                #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_mutex\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+#if defined(BUILD_SYNC_WITH_TIMER) && defined(SYNC_TIMER_TSC)
+static bool timer_tsc = false;
+static once_flag timer_tsc_once = SYNC_ONCE_INIT;
+#endif
 
-                // Error
-                return 0;
-        }
-    }
-}
+#ifdef BUILD_SYNC_WITH_TIMER
+static size_t timer_histogram_shards = 0;
+static __thread size_t timer_histogram_shard = SIZE_MAX;
+#endif
 
-int mutex_lock ( mutex *p_mutex )
-{
+#ifdef BUILD_SYNC_WITH_TRACE
+static struct sync_trace_ring_s *p_sync_trace_rings = (void *) 0;
+static __thread struct sync_trace_ring_s *p_sync_trace_ring = (void *) 0;
+#ifdef _WIN64
+static DWORD sync_trace_key = 0;
+#else
+static pthread_key_t sync_trace_key;
+#endif
+#endif
 
-    // Platform dependent implementation
-    #ifdef _WIN64
+#ifdef BUILD_SYNC_WITH_RCU
+static uint64_t rcu_epoch = 1;
+static uint32_t rcu_lock = 0;
+static bool rcu_membarrier = false;
+static struct rcu_thread_s *p_rcu_threads = (void *) 0;
+static __thread struct rcu_thread_s *p_rcu_thread = (void *) 0;
+#ifdef _WIN64
+static DWORD rcu_key = 0;
+#else
+static pthread_key_t rcu_key;
+#endif
+#endif
 
-        // Platform dependent argument check
-        if ( _mutex == INVALID_HANDLE_VALUE ) goto no_mutex;
+#ifdef BUILD_SYNC_WITH_POOL
+static __thread struct sync_pool_worker_s *p_sync_pool_worker = (void *) 0;
+#endif
 
-        // Return
-        return ( WaitForSingleObject(_mutex, INFINITE) == WAIT_FAILED ? 0 : 1 );
-    #else
+#ifdef BUILD_SYNC_WITH_HAZARD_POINTER
+static struct hazptr_thread_s *p_hazptr_threads = (void *) 0;
+static size_t hazptr_threads = 0;
+static uint32_t hazptr_lock = 0;
+static struct hazptr_retired_s *p_hazptr_orphans = (void *) 0;
+static size_t hazptr_orphans = 0;
+static __thread struct hazptr_thread_s *p_hazptr_thread = (void *) 0;
+#ifdef _WIN64
+static DWORD hazptr_key = 0;
+#else
+static pthread_key_t hazptr_key;
+#endif
+#endif
 
-        // Log
-        #ifdef SYNC_DEBUG
-            log_info("[sync] [mutex] Locking mutex @ 0x%x\n", (size_t)p_mutex & 0xffff);
-        #endif
-        
-        // Return
-        return ( pthread_mutex_lock(p_mutex) == 0 );
-    #endif
+// Structure definitions
+#ifdef BUILD_SYNC_WITH_RW_LOCK
+struct brlock_slot_s
+{
+    uint32_t readers;
+} __attribute__((aligned(SYNC_CACHE_LINE)));
+#endif
 
-    // Error handling
+#ifdef BUILD_SYNC_WITH_TRACE
+struct sync_trace_ring_s
+{
+    struct sync_trace_ring_s *p_next;
+    uint64_t                  head;
+    long                      thread;
+    bool                      owned;
+    struct
     {
+        timestamp   _time;
+        const void *p_object;
+        int         event;
+    } records[SYNC_TRACE_RING_SIZE];
+};
+#endif
 
-        // Argument error
-        {
-            #ifdef _WIN64
-                no_mutex:
-                    #ifndef NDEBUG
-                        log_error("[sync] Invalid parameter provided for \"_mutex\" in call to function \"%s\"\n", __FUNCTION__);
-                    #endif
-
-                    // Error
-                    return 0;
-            #endif
-        }
-    }
-}
-
-int mutex_unlock ( mutex *p_mutex )
+#ifdef BUILD_SYNC_WITH_RCU
+struct rcu_callback_s
 {
+    fn_rcu_callback *pfn_rcu_callback;
+    void            *p_value;
+};
 
-    // Platform dependent implementation
-    #ifdef _WIN64
-        // Platform dependent argument check
-    if ( _mutex == INVALID_HANDLE_VALUE ) goto no_mutex;
-        // Return
-        return ReleaseMutex(_mutex);
-    #else
-
-        // Log
-        #ifdef SYNC_DEBUG
-            log_info("[sync] [mutex] Unlocking mutex @ 0x%x\n", (size_t)p_mutex & 0xffff);
-        #endif
-        
-        // Return
-        return ( pthread_mutex_unlock(p_mutex) == 0 );
-    #endif
+struct rcu_thread_s
+{
+    uint64_t               epoch;
+    struct rcu_thread_s   *p_next;
+    size_t                 nest, count, max;
+    struct rcu_callback_s *p_callbacks;
+} __attribute__((aligned(SYNC_CACHE_LINE)));
+#endif
 
-    // Error handling
-    {
+#ifdef BUILD_SYNC_WITH_HAZARD_POINTER
+struct hazptr_retired_s
+{
+    void              *p_value;
+    fn_hazptr_reclaim *pfn_hazptr_reclaim;
+};
 
-        // Argument error
-        {
+struct hazptr_thread_s
+{
+    void                    *slots[SYNC_HAZPTR_SLOTS];
+    struct hazptr_thread_s  *p_next;
+    uint32_t                 active;
+    bool                     scanning;
+    size_t                   count, max;
+    struct hazptr_retired_s *p_retired;
+} __attribute__((aligned(SYNC_CACHE_LINE)));
+#endif
 
-            #ifdef _WIN64
-                no_mutex:
-                    #ifndef NDEBUG
-                        log_error("[sync] Invalid parameter provided for \"_mutex\" in call to function \"%s\"\n", __FUNCTION__);
-                    #endif
+#ifdef BUILD_SYNC_WITH_SEMAPHORE
+struct wsem_waiter_s
+{
+    struct wsem_waiter_s *p_next;
+    uint64_t              permits;
+    uint32_t              granted;
+};
+#endif
 
-                    // Error
-                    return 0;
-            #endif
-        }
-    }
-}
+#ifdef BUILD_SYNC_WITH_BARRIER
+struct barrier_node_s
+{
+    uint32_t               arrived, filled, expected;
+    struct barrier_node_s *p_parent;
+    double                 values[SYNC_BARRIER_FAN_IN];
+} __attribute__((aligned(SYNC_CACHE_LINE)));
+#endif
 
-int mutex_destroy ( mutex *p_mutex )
+#ifdef BUILD_SYNC_WITH_POOL
+struct sync_pool_task_s
 {
+    fn_sync_pool_task *pfn_sync_pool_task;
+    void              *p_parameter;
+};
 
-    // Argument check
-    if ( p_mutex == (void *) 0 ) goto no_mutex;
+struct sync_pool_array_s
+{
+    size_t                    size;
+    struct sync_pool_array_s *p_previous;
+    struct sync_pool_task_s   tasks[];
+};
 
-    // Platform dependent implementation
+struct sync_pool_worker_s
+{
+    int64_t                   top;
+    int64_t                   bottom __attribute__((aligned(SYNC_CACHE_LINE)));
+    struct sync_pool_array_s *p_array;
+    struct sync_pool_s       *p_sync_pool;
+    uint64_t                  random;
+    size_t                    index, node_first, node_quantity;
+    int                       cpu, node;
     #ifdef _WIN64
-
-        // Return
-        return ( CloseHandle(*p_mutex) );
+        HANDLE                thread;
     #else
-
-        // Return
-        return ( pthread_mutex_destroy(p_mutex) == 0 );
+        pthread_t             thread;
     #endif
+} __attribute__((aligned(SYNC_CACHE_LINE)));
 
-    // Error handling
-    {
-        
-        // Argument errors
-        {
-            no_mutex:
-                #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_mutex\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error
-                return 0;
-        }
-    }
-}
+struct sync_pool_s
+{
+    latch                      pending, ready;
+    eventcount                 idle;
+    bool                       shutdown;
+    uint32_t                   lock;
+    size_t                     inject_head, inject_quantity, inject_size;
+    struct sync_pool_task_s   *p_inject;
+    size_t                     workers;
+    size_t                    *p_order;
+    struct sync_pool_worker_s *p_workers;
+};
 #endif
 
-#ifdef BUILD_SYNC_WITH_SPINLOCK
-int spinlock_create ( spinlock *p_spinlock )
+#ifdef BUILD_SYNC_WITH_TIMER
+struct timer_histogram_s
 {
+    struct
+    {
+        uint64_t counts[SYNC_HISTOGRAM_BUCKETS];
+    } __attribute__((aligned(SYNC_CACHE_LINE))) shards[SYNC_HISTOGRAM_SHARDS];
+};
+#endif
 
-    // Argument check
-    if ( p_spinlock == (void *) 0 ) goto no_spinlock;
+// Futex
+/** !
+ * Sleep while a word holds an expected value. The wait may 
+ * return spuriously; callers must recheck the word.
+ * 
+ * @param p_word   the word
+ * @param expected the value to sleep on
+ * 
+ * @sa sync_futex_wake
+ * 
+ * @return void
+ */
+static inline void sync_futex_wait ( uint32_t *p_word, uint32_t expected )
+{
 
     // Platform dependent implementation
-    #ifdef _WIN64
+    #if defined(__linux__)
+        (void) syscall(SYS_futex, p_word, FUTEX_WAIT_PRIVATE, expected, (void *) 0, (void *) 0, 0);
+    #elif defined(_WIN64)
+        (void) p_word, (void) expected;
+        SwitchToThread();
     #else
-
-        // Return
-        return ( pthread_spin_init(p_spinlock, 0) == 0 );
+        (void) p_word, (void) expected;
+        sched_yield();
     #endif
 
-    // Error handling
-    {
-        
-        // Argument errors
-        {
-            no_spinlock:
-                #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_spinlock\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error
-                return 0;
-        }
-    }
+    // Done
+    return;
 }
 
-int spinlock_lock ( spinlock *p_spinlock )
+/** !
+ * Wake threads that are sleeping on a word
+ * 
+ * @param p_word the word
+ * @param count  the maximum quantity of threads to wake
+ * 
+ * @sa sync_futex_wait
+ * 
+ * @return void
+ */
+static inline void sync_futex_wake ( uint32_t *p_word, int count )
 {
 
     // Platform dependent implementation
-    #ifdef _WIN64
+    #if defined(__linux__)
+        (void) syscall(SYS_futex, p_word, FUTEX_WAKE_PRIVATE, count, (void *) 0, (void *) 0, 0);
     #else
-
-        // Return
-        return ( pthread_spin_lock(p_spinlock) == 0 );
+        (void) p_word, (void) count;
     #endif
 
-    // Error handling
-    {
+    // Done
+    return;
+}
 
-        // Argument error
-        {
-            #ifdef _WIN64
-                no_spinlock:
-                    #ifndef NDEBUG
-                        log_error("[sync] Invalid parameter provided for \"_spinlock\" in call to function \"%s\"\n", __FUNCTION__);
-                    #endif
+/** !
+ * Wake one thread that is sleeping on a word, and move the rest 
+ * onto another word, if the word still holds an expected value
+ * 
+ * @param p_word   the word
+ * @param expected the value of the word
+ * @param p_target the word to move the sleepers onto
+ * 
+ * @sa sync_futex_wake
+ * 
+ * @return true if the sleepers were moved, else false
+ */
+static inline bool sync_futex_requeue ( uint32_t *p_word, uint32_t expected, uint32_t *p_target )
+{
 
-                    // Error
-                    return 0;
-            #endif
-        }
-    }
+    // Platform dependent implementation
+    #if defined(__linux__)
+        return syscall(SYS_futex, p_word, FUTEX_CMP_REQUEUE_PRIVATE, 1, (void *)(uintptr_t) INT_MAX, p_target, expected) >= 0;
+    #else
+        (void) p_word, (void) expected, (void) p_target;
+        return false;
+    #endif
 }
 
-int spinlock_unlock ( spinlock *p_spinlock )
+/** !
+ * Hint to the processor that the calling thread is spinning
+ * 
+ * @param void
+ * 
+ * @return void
+ */
+static inline void sync_pause ( void )
 {
 
     // Platform dependent implementation
-    #ifdef _WIN64
+    #if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+    #elif defined(__aarch64__)
+        __asm__ __volatile__ ( "yield" ::: "memory" );
     #else
-
-        // Return
-        return ( pthread_spin_unlock(p_spinlock) == 0 );
+        __asm__ __volatile__ ( "" ::: "memory" );
     #endif
 
-    // Error handling
-    {
-
-        // Argument error
+    // Done
+    return;
+}
+
+/** !
+ * Get a small, stable index for the calling thread. Indices are
+ * handed out in order, so threads spread evenly over shards.
+ * 
+ * @param void
+ * 
+ * @return the index of the calling thread
+ */
+static inline size_t sync_thread_index ( void )
+{
+
+    // Assign an index to the calling thread
+    if ( sync_thread == SIZE_MAX ) sync_thread = __atomic_fetch_add(&sync_threads, 1, __ATOMIC_RELAXED);
+
+    // Done
+    return sync_thread;
+}
+
+/** !
+ * Spin once. Every so often, the calling thread yields, so a
+ * spinning thread can't starve a preempted owner indefinitely.
+ * 
+ * @param p_spins the quantity of times the caller has spun
+ * 
+ * @return void
+ */
+static inline void sync_spin ( unsigned int *p_spins )
+{
+
+    // Spin
+    sync_pause();
+
+    // Yield, every so often
+    if ( ++(*p_spins) % SYNC_SPIN_YIELD == 0 )
+    {
+        #ifdef _WIN64
+            SwitchToThread();
+        #else
+            sched_yield();
+        #endif
+    }
+
+    // Done
+    return;
+}
+
+/** !
+ * Read the monotonic clock in nanoseconds
+ * 
+ * @param void
+ * 
+ * @return the monotonic time in nanoseconds
+ */
+static timestamp timer_monotonic_ns ( void )
+{
+
+    // Platform dependent implementation
+    #ifdef _WIN64
+
+        // Done
+        return (timestamp) GetTickCount64() * 1000000;
+    #else
+
+        // Initialized data
+        struct timespec ts;
+
+        // Populate the time struct using the monotonic timer
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+
+        // Done
+        return ( (timestamp) ts.tv_sec * SEC_2_NS ) + (timestamp) ts.tv_nsec;
+    #endif
+}
+
+/** !
+ * Sleep while a word holds an expected value, for at most a 
+ * quantity of time. The wait may return early; callers must 
+ * recheck the word, and the clock.
+ * 
+ * @param p_word   the word
+ * @param expected the value to sleep on
+ * @param _time    the quantity of time to wait, in nanoseconds
+ * 
+ * @sa sync_futex_wait
+ * 
+ * @return void
+ */
+static inline void sync_futex_wait_timeout ( uint32_t *p_word, uint32_t expected, timestamp _time )
+{
+
+    // Platform dependent implementation
+    #if defined(__linux__)
+        struct timespec timeout = 
+        {
+            .tv_sec  = (time_t) ( _time / SEC_2_NS ),
+            .tv_nsec = (long)   ( _time % SEC_2_NS )
+        };
+
+        (void) syscall(SYS_futex, p_word, FUTEX_WAIT_PRIVATE, expected, &timeout, (void *) 0, 0);
+    #else
+        (void) _time;
+        sync_futex_wait(p_word, expected);
+    #endif
+
+    // Done
+    return;
+}
+
+/** !
+ * Lock a word, like a fast mutex
+ * 
+ * @param p_word the word
+ * 
+ * @sa sync_word_unlock
+ * 
+ * @return void
+ */
+static inline void sync_word_lock ( uint32_t *p_word )
+{
+
+    // Initialized data
+    uint32_t expected = 0;
+
+    // Fast path
+    if ( __atomic_compare_exchange_n(p_word, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) ) return;
+
+    // Slow path
+    while ( __atomic_exchange_n(p_word, 2, __ATOMIC_ACQUIRE) != 0 ) sync_futex_wait(p_word, 2);
+
+    // Done
+    return;
+}
+
+/** !
+ * Unlock a word
+ * 
+ * @param p_word the word
+ * 
+ * @sa sync_word_lock
+ * 
+ * @return void
+ */
+static inline void sync_word_unlock ( uint32_t *p_word )
+{
+
+    // Unlock, and wake a waiter
+    if ( __atomic_exchange_n(p_word, 0, __ATOMIC_RELEASE) == 2 ) sync_futex_wake(p_word, 1);
+
+    // Done
+    return;
+}
+
+// Forward declarations
+#ifdef BUILD_SYNC_WITH_RCU
+static void rcu_thread_exit ( void *p_thread_record );
+#endif
+
+#ifdef BUILD_SYNC_WITH_HAZARD_POINTER
+static void hazptr_thread_exit ( void *p_thread_record );
+#endif
+
+#ifdef BUILD_SYNC_WITH_TRACE
+static void sync_trace_thread_exit ( void *p_trace_ring );
+#endif
+
+#ifdef BUILD_SYNC_WITH_TIMER
+#ifdef SYNC_TIMER_TSC
+
+/** !
+ * Sample the time stamp counter, and the monotonic clock at the
+ * same instant. The sample with the tightest bracket is kept, so
+ * an interrupt between the reads doesn't skew the result.
+ * 
+ * @param p_ns  return the monotonic time in nanoseconds
+ * @param p_tsc return the time stamp counter
+ * 
+ * @return void
+ */
+static void timer_tsc_sample ( timestamp *p_ns, timestamp *p_tsc )
+{
+
+    // Initialized data
+    timestamp best = INT64_MAX;
+    unsigned int aux = 0;
+
+    // Take a few samples
+    for (size_t i = 0; i < SYNC_TIMER_TSC_SAMPLES; i++)
+    {
+
+        // Initialized data
+        timestamp a   = timer_monotonic_ns(),
+                  tsc = (timestamp) __rdtscp(&aux),
+                  b   = timer_monotonic_ns();
+
+        // Keep the tightest bracket
+        if ( b - a < best ) best = b - a, *p_ns = a + ( ( b - a ) / 2 ), *p_tsc = tsc;
+    }
+
+    // Done
+    return;
+}
+
+/** !
+ * Calibrate the time stamp counter against the monotonic clock.
+ * The TSC is only used if it is invariant, if the processor 
+ * supports rdtscp, and if every core the process may run on 
+ * agrees on the time.
+ * 
+ * @param p_frequency return the frequency of the TSC in ticks per second
+ * 
+ * @return true if the TSC is usable, else false
+ */
+static bool timer_tsc_calibrate ( timestamp *p_frequency )
+{
+
+    // Initialized data
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    timestamp ns_0 = 0, tsc_0 = 0, ns_1 = 0, tsc_1 = 0, frequency = 0;
+    cpu_set_t original, pinned;
+    bool ret = true;
+
+    // Check for the extended leaves
+    if ( __get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) == 0 ) return false;
+    if ( eax < 0x80000007 ) return false;
+
+    // Check for rdtscp
+    __get_cpuid(0x80000001, &eax, &ebx, &ecx, &edx);
+    if ( ( edx & ( 1U << 27 ) ) == 0 ) return false;
+
+    // Check for an invariant TSC
+    __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+    if ( ( edx & ( 1U << 8 ) ) == 0 ) return false;
+
+    // Calibrate
+    timer_tsc_sample(&ns_0, &tsc_0);
+    do { timer_tsc_sample(&ns_1, &tsc_1); } while ( ns_1 - ns_0 < SYNC_TIMER_CALIBRATION_NS );
+
+    // Compute the frequency
+    frequency = ( ( tsc_1 - tsc_0 ) * SEC_2_NS ) / ( ns_1 - ns_0 );
+
+    // Error check
+    if ( frequency <= 0 ) return false;
+
+    // Store the affinity of the calling thread
+    if ( sched_getaffinity(0, sizeof(cpu_set_t), &original) ) return false;
+
+    // Check the TSC on each core against the calibration
+    for (size_t i = 0; i < CPU_SETSIZE && ret; i++)
+    {
+
+        // Initialized data
+        timestamp ns = 0, tsc = 0, expected = 0, skew = 0;
+
+        // Skip cores the process may not run on
+        if ( CPU_ISSET(i, &original) == 0 ) continue;
+
+        // Pin the calling thread to the core
+        CPU_ZERO(&pinned);
+        CPU_SET(i, &pinned);
+        if ( sched_setaffinity(0, sizeof(cpu_set_t), &pinned) ) { ret = false; break; }
+
+        // Sample
+        timer_tsc_sample(&ns, &tsc);
+
+        // Compute the skew in nanoseconds
+        expected = tsc_0 + ( ( ns - ns_0 ) * frequency ) / SEC_2_NS;
+        skew     = ( ( tsc - expected ) * SEC_2_NS ) / frequency;
+
+        // Check the skew
+        if ( skew > SYNC_TIMER_TSC_MAX_SKEW_NS || skew < -SYNC_TIMER_TSC_MAX_SKEW_NS ) ret = false;
+    }
+
+    // Restore the affinity of the calling thread
+    (void) sched_setaffinity(0, sizeof(cpu_set_t), &original);
+
+    // Return the frequency
+    *p_frequency = frequency;
+
+    // Done
+    return ret;
+}
+
+/** !
+ * Calibrate the time stamp counter on the first call to the timer,
+ * so programs that never read the timer don't pay for it
+ * 
+ * @param p_parameter unused
+ * 
+ * @return void
+ */
+static void timer_tsc_init ( void *p_parameter )
+{
+
+    // Initialized data
+    timestamp frequency = 0;
+
+    // Unused
+    (void) p_parameter;
+
+    // Use the time stamp counter, if possible
+    timer_tsc = timer_tsc_calibrate(&frequency);
+
+    // Otherwise, fall back to the monotonic clock
+    if ( timer_tsc ) SYNC_TIMER_DIVISOR = frequency;
+
+    // Done
+    return;
+}
+#endif
+#endif
+
+void sync_init ( void ) 
+{
+
+    // State check
+    if ( initialized == true ) return;
+
+    // Initialize the log library
+    log_init();
+
+    // Count the online processors
+    #ifndef _WIN64
+        sync_processors = sysconf(_SC_NPROCESSORS_ONLN);
+        if ( sync_processors < 1 ) sync_processors = 1;
+    #endif
+
+    // Prepare read copy update
+    #ifdef BUILD_SYNC_WITH_RCU
+
+        // Clean up after each reader thread
+        #ifdef _WIN64
+            rcu_key = FlsAlloc(rcu_thread_exit);
+        #else
+            (void) pthread_key_create(&rcu_key, rcu_thread_exit);
+        #endif
+
+        // Let grace periods fence readers, so readers don't have to
+        #if defined(__linux__) && defined(SYS_membarrier)
+        {
+
+            // Initialized data
+            long commands = syscall(SYS_membarrier, MEMBARRIER_CMD_QUERY, 0, 0);
+
+            // Register for expedited memory barriers
+            if ( commands > 0 && ( commands & MEMBARRIER_CMD_PRIVATE_EXPEDITED ) )
+                rcu_membarrier = ( syscall(SYS_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) == 0 );
+        }
+        #endif
+    #endif
+
+    // Prepare hazard pointers
+    #ifdef BUILD_SYNC_WITH_HAZARD_POINTER
+
+        // Release each thread's hazard slots when it exits
+        #ifdef _WIN64
+            hazptr_key = FlsAlloc(hazptr_thread_exit);
+        #else
+            (void) pthread_key_create(&hazptr_key, hazptr_thread_exit);
+        #endif
+    #endif
+
+    // Release each thread's trace ring when it exits
+    #ifdef BUILD_SYNC_WITH_TRACE
+        #ifdef _WIN64
+            sync_trace_key = FlsAlloc(sync_trace_thread_exit);
+        #else
+            (void) pthread_key_create(&sync_trace_key, sync_trace_thread_exit);
+        #endif
+    #endif
+
+    // Platform dependent implementation
+    #ifdef _WIN64
+        QueryPerformanceFrequency((LARGE_INTEGER *)&SYNC_TIMER_DIVISOR);
+    #else
+
+        // Update the timer divisor. The time stamp counter is 
+        // calibrated on the first call to the timer
+        SYNC_TIMER_DIVISOR = SEC_2_NS;
+    #endif
+
+    // Set the initialized flag
+    initialized = true;
+
+    // Done
+    return;
+}
+
+#ifdef BUILD_SYNC_WITH_STATS
+/** !
+ * Raise a maximum to a value
+ * 
+ * @param p_max the maximum
+ * @param value the value
+ * 
+ * @return void
+ */
+static void sync_stats_max ( timestamp *p_max, timestamp value )
+{
+
+    // Initialized data
+    timestamp max = __atomic_load_n(p_max, __ATOMIC_RELAXED);
+
+    // Raise the maximum
+    while ( value > max && !__atomic_compare_exchange_n(p_max, &max, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED) );
+
+    // Done
+    return;
+}
+
+/** !
+ * Record an acquisition
+ * 
+ * @param p_stats   the stats of the primitive
+ * @param contended true if the caller had to wait, else false
+ * @param wait      the time the caller waited
+ * 
+ * @return void
+ */
+static void sync_stats_acquire ( sync_stats *p_stats, bool contended, timestamp wait )
+{
+
+    // Count the acquisition
+    __atomic_fetch_add(&p_stats->acquires, 1, __ATOMIC_RELAXED);
+
+    // Uncontended acquisitions don't wait
+    if ( contended == false ) return;
+
+    // Record the wait
+    __atomic_fetch_add(&p_stats->contended, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&p_stats->wait_total, wait, __ATOMIC_RELAXED);
+    sync_stats_max(&p_stats->wait_max, wait);
+
+    // Done
+    return;
+}
+
+/** !
+ * Record a release
+ * 
+ * @param p_stats  the stats of the primitive
+ * @param acquired the time the primitive was acquired
+ * 
+ * @return void
+ */
+static void sync_stats_release ( sync_stats *p_stats, timestamp acquired )
+{
+
+    // Initialized data
+    timestamp hold = timer_high_precision() - acquired;
+
+    // Record the hold
+    __atomic_fetch_add(&p_stats->hold_total, hold, __ATOMIC_RELAXED);
+    sync_stats_max(&p_stats->hold_max, hold);
+
+    // Done
+    return;
+}
+
+/** !
+ * Copy the stats of a primitive
+ * 
+ * @param p_source the stats of the primitive
+ * @param p_stats  return
+ * 
+ * @return void
+ */
+static void sync_stats_copy ( const sync_stats *p_source, sync_stats *p_stats )
+{
+
+    // Copy the stats
+    *p_stats = (sync_stats)
+    {
+        .acquires   = __atomic_load_n(&p_source->acquires  , __ATOMIC_RELAXED),
+        .contended  = __atomic_load_n(&p_source->contended , __ATOMIC_RELAXED),
+        .wait_total = __atomic_load_n(&p_source->wait_total, __ATOMIC_RELAXED),
+        .wait_max   = __atomic_load_n(&p_source->wait_max  , __ATOMIC_RELAXED),
+        .hold_total = __atomic_load_n(&p_source->hold_total, __ATOMIC_RELAXED),
+        .hold_max   = __atomic_load_n(&p_source->hold_max  , __ATOMIC_RELAXED)
+    };
+
+    // Done
+    return;
+}
+
+#if defined(BUILD_SYNC_WITH_MUTEX) && !defined(_WIN64)
+int mutex_stats_get ( const mutex *p_mutex, sync_stats *p_stats )
+{
+
+    // Argument check
+    if ( p_mutex == (void *) 0 ) goto no_mutex;
+    if ( p_stats == (void *) 0 ) goto no_stats;
+
+    // Copy the stats
+    sync_stats_copy(&p_mutex->_stats, p_stats);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_mutex:
+                #ifndef NDEBUG
+                    log_error("[sync] [stats] Null pointer provided for parameter \"p_mutex\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_stats:
+                #ifndef NDEBUG
+                    log_error("[sync] [stats] Null pointer provided for parameter \"p_stats\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+#endif
+
+#if defined(BUILD_SYNC_WITH_SPINLOCK) && !defined(_WIN64)
+int spinlock_stats_get ( const spinlock *p_spinlock, sync_stats *p_stats )
+{
+
+    // Argument check
+    if ( p_spinlock == (void *) 0 ) goto no_spinlock;
+    if ( p_stats    == (void *) 0 ) goto no_stats;
+
+    // Copy the stats
+    sync_stats_copy(&p_spinlock->_stats, p_stats);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_spinlock:
+                #ifndef NDEBUG
+                    log_error("[sync] [stats] Null pointer provided for parameter \"p_spinlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_stats:
+                #ifndef NDEBUG
+                    log_error("[sync] [stats] Null pointer provided for parameter \"p_stats\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+#endif
+
+#ifdef BUILD_SYNC_WITH_RW_LOCK
+int rwlock_stats_get ( const rwlock *p_rwlock, sync_stats *p_stats )
+{
+
+    // Argument check
+    if ( p_rwlock == (void *) 0 ) goto no_rwlock;
+    if ( p_stats  == (void *) 0 ) goto no_stats;
+
+    // Copy the stats
+    sync_stats_copy(&p_rwlock->_stats, p_stats);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_rwlock:
+                #ifndef NDEBUG
+                    log_error("[sync] [stats] Null pointer provided for parameter \"p_rwlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_stats:
+                #ifndef NDEBUG
+                    log_error("[sync] [stats] Null pointer provided for parameter \"p_stats\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+#endif
+
+#ifdef BUILD_SYNC_WITH_SEMAPHORE
+int semaphore_stats_get ( const semaphore *p_semaphore, sync_stats *p_stats )
+{
+
+    // Argument check
+    if ( p_semaphore == (void *) 0 ) goto no_semaphore;
+    if ( p_stats     == (void *) 0 ) goto no_stats;
+
+    // Copy the stats
+    sync_stats_copy(&p_semaphore->_stats, p_stats);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_semaphore:
+                #ifndef NDEBUG
+                    log_error("[sync] [stats] Null pointer provided for parameter \"p_semaphore\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_stats:
+                #ifndef NDEBUG
+                    log_error("[sync] [stats] Null pointer provided for parameter \"p_stats\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+#endif
+#endif
+
+#ifdef BUILD_SYNC_WITH_MUTEX
+int mutex_create ( mutex *p_mutex )
+{
+
+    // Argument check
+    if ( p_mutex == (void *) 0 ) goto no_mutex;
+
+    // Platform dependent implementation
+    #ifdef _WIN64
+
+        // Create a mutex
+        *p_mutex = CreateMutex(0, FALSE, 0);
+
+        // Return
+        return ( *p_mutex != 0 );
+    #else
+
+        // Clear the stats
+        #ifdef BUILD_SYNC_WITH_STATS
+            p_mutex->_stats = (sync_stats) { 0 };
+        #endif
+
+        // Return
+        return ( pthread_mutex_init(SYNC_NATIVE(p_mutex, _mutex), NULL) == 0 );
+    #endif
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_mutex:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_mutex\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int mutex_lock ( mutex *p_mutex )
+{
+
+    // Platform dependent implementation
+    #ifdef _WIN64
+
+        // Platform dependent argument check
+        if ( _mutex == INVALID_HANDLE_VALUE ) goto no_mutex;
+
+        // Return
+        return ( WaitForSingleObject(_mutex, INFINITE) == WAIT_FAILED ? 0 : 1 );
+    #else
+
+        // Initialized data
+        int ret = 0;
+
+        // Trace
+        #ifdef BUILD_SYNC_WITH_TRACE
+            sync_trace_record(SYNC_TRACE_MUTEX_LOCK, p_mutex);
+        #endif
+
+        // Lock
+        #ifdef BUILD_SYNC_WITH_STATS
+            SYNC_STATS_LOCK(p_mutex, ret, pthread_mutex_trylock(&p_mutex->_mutex), pthread_mutex_lock(&p_mutex->_mutex));
+
+            // Store the time the mutex was acquired
+            if ( ret ) p_mutex->_acquired = timer_high_precision();
+        #else
+            ret = ( pthread_mutex_lock(p_mutex) == 0 );
+        #endif
+
+        // Trace
+        #ifdef BUILD_SYNC_WITH_TRACE
+            sync_trace_record(SYNC_TRACE_MUTEX_ACQUIRED, p_mutex);
+        #endif
+
+        // Return
+        return ret;
+    #endif
+
+    // Error handling
+    {
+
+        // Argument error
+        {
+            #ifdef _WIN64
+                no_mutex:
+                    #ifndef NDEBUG
+                        log_error("[sync] Invalid parameter provided for \"_mutex\" in call to function \"%s\"\n", __FUNCTION__);
+                    #endif
+
+                    // Error
+                    return 0;
+            #endif
+        }
+    }
+}
+
+int mutex_unlock ( mutex *p_mutex )
+{
+
+    // Platform dependent implementation
+    #ifdef _WIN64
+        // Platform dependent argument check
+    if ( _mutex == INVALID_HANDLE_VALUE ) goto no_mutex;
+        // Return
+        return ReleaseMutex(_mutex);
+    #else
+
+        // Trace
+        #ifdef BUILD_SYNC_WITH_TRACE
+            sync_trace_record(SYNC_TRACE_MUTEX_UNLOCK, p_mutex);
+        #endif
+
+        // Record the hold
+        #ifdef BUILD_SYNC_WITH_STATS
+            sync_stats_release(&p_mutex->_stats, p_mutex->_acquired);
+        #endif
+        
+        // Return
+        return ( pthread_mutex_unlock(SYNC_NATIVE(p_mutex, _mutex)) == 0 );
+    #endif
+
+    // Error handling
+    {
+
+        // Argument error
+        {
+
+            #ifdef _WIN64
+                no_mutex:
+                    #ifndef NDEBUG
+                        log_error("[sync] Invalid parameter provided for \"_mutex\" in call to function \"%s\"\n", __FUNCTION__);
+                    #endif
+
+                    // Error
+                    return 0;
+            #endif
+        }
+    }
+}
+
+int mutex_destroy ( mutex *p_mutex )
+{
+
+    // Argument check
+    if ( p_mutex == (void *) 0 ) goto no_mutex;
+
+    // Platform dependent implementation
+    #ifdef _WIN64
+
+        // Return
+        return ( CloseHandle(*p_mutex) );
+    #else
+
+        // Return
+        return ( pthread_mutex_destroy(SYNC_NATIVE(p_mutex, _mutex)) == 0 );
+    #endif
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_mutex:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_mutex\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int fast_mutex_create ( fast_mutex *p_fast_mutex )
+{
+
+    // Argument check
+    if ( p_fast_mutex == (void *) 0 ) goto no_fast_mutex;
+
+    // Unlocked
+    __atomic_store_n(&p_fast_mutex->_state, 0, __ATOMIC_RELEASE);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_fast_mutex:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_fast_mutex\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int fast_mutex_lock_slow ( fast_mutex *p_fast_mutex )
+{
+
+    // Argument check
+    if ( p_fast_mutex == (void *) 0 ) goto no_fast_mutex;
+
+    // Mark the mutex as contended. If it was unlocked, the mutex is now owned
+    while ( __atomic_exchange_n(&p_fast_mutex->_state, 2, __ATOMIC_ACQUIRE) != 0 )
+
+        // Sleep until the owner unlocks the mutex
+        sync_futex_wait(&p_fast_mutex->_state, 2);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_fast_mutex:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_fast_mutex\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int fast_mutex_unlock_slow ( fast_mutex *p_fast_mutex )
+{
+
+    // Argument check
+    if ( p_fast_mutex == (void *) 0 ) goto no_fast_mutex;
+
+    // Wake one waiter
+    sync_futex_wake(&p_fast_mutex->_state, 1);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_fast_mutex:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_fast_mutex\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int fast_mutex_destroy ( fast_mutex *p_fast_mutex )
+{
+
+    // Argument check
+    if ( p_fast_mutex == (void *) 0 ) goto no_fast_mutex;
+
+    // Error check
+    if ( __atomic_load_n(&p_fast_mutex->_state, __ATOMIC_ACQUIRE) != 0 ) goto mutex_locked;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_fast_mutex:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_fast_mutex\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Sync errors
+        {
+            mutex_locked:
+                #ifndef NDEBUG
+                    log_error("[sync] [mutex] Can not destroy a locked mutex in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+#ifdef BUILD_SYNC_WITH_TIMER
+int adaptive_mutex_create ( adaptive_mutex *p_adaptive_mutex )
+{
+
+    // Argument check
+    if ( p_adaptive_mutex == (void *) 0 ) goto no_adaptive_mutex;
+
+    // Unlocked, with no history
+    *p_adaptive_mutex = (adaptive_mutex) { 0 };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_adaptive_mutex:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_adaptive_mutex\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int adaptive_mutex_lock ( adaptive_mutex *p_adaptive_mutex )
+{
+
+    // Argument check
+    if ( p_adaptive_mutex == (void *) 0 ) goto no_adaptive_mutex;
+
+    // Initialized data
+    uint32_t expected = 0;
+    timestamp now = 0, deadline = 0;
+
+    // Fast path
+    if ( __atomic_compare_exchange_n(&p_adaptive_mutex->_state, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) ) goto done;
+
+    // Spin for as long as the lock is usually held
+    now      = timer_high_precision();
+    deadline = now + __atomic_load_n(&p_adaptive_mutex->_spin, __ATOMIC_RELAXED);
+
+    // Spin
+    while ( now < deadline )
+    {
+
+        // Only try to lock the mutex if it looks unlocked
+        if ( __atomic_load_n(&p_adaptive_mutex->_state, __ATOMIC_RELAXED) == 0 )
+        {
+
+            // Unlocked -> locked
+            expected = 0;
+            if ( __atomic_compare_exchange_n(&p_adaptive_mutex->_state, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) ) goto done;
+        }
+
+        // Spin
+        sync_pause();
+
+        // Update the time
+        now = timer_high_precision();
+    }
+
+    // Park, like a fast mutex
+    while ( __atomic_exchange_n(&p_adaptive_mutex->_state, 2, __ATOMIC_ACQUIRE) != 0 )
+        sync_futex_wait(&p_adaptive_mutex->_state, 2);
+
+    done:
+
+    // Sample the time the lock was acquired, every so often
+    p_adaptive_mutex->_acquired = ( ++p_adaptive_mutex->_count % SYNC_ADAPTIVE_SAMPLE_PERIOD ) ? 0 : timer_high_precision();
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_adaptive_mutex:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_adaptive_mutex\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int adaptive_mutex_unlock ( adaptive_mutex *p_adaptive_mutex )
+{
+
+    // Argument check
+    if ( p_adaptive_mutex == (void *) 0 ) goto no_adaptive_mutex;
+
+    // Update the spin budget, if this acquisition was sampled
+    if ( p_adaptive_mutex->_acquired )
+    {
+
+        // Initialized data
+        timestamp hold = timer_high_precision() - p_adaptive_mutex->_acquired,
+                  spin = 0;
+
+        // Update the moving average of the hold time
+        p_adaptive_mutex->_hold += ( hold - p_adaptive_mutex->_hold ) / 8;
+
+        // Spin for twice the average hold time, up to a limit
+        spin = 2 * p_adaptive_mutex->_hold;
+        if ( spin > ( SYNC_TIMER_DIVISOR * SYNC_ADAPTIVE_MAX_SPIN_NS ) / SEC_2_NS ) spin = ( SYNC_TIMER_DIVISOR * SYNC_ADAPTIVE_MAX_SPIN_NS ) / SEC_2_NS;
+        if ( spin < 0 ) spin = 0;
+
+        // Spinning is pointless if the owner can't run at the same time
+        if ( sync_processors == 1 ) spin = 0;
+
+        // Store the spin budget
+        __atomic_store_n(&p_adaptive_mutex->_spin, spin, __ATOMIC_RELAXED);
+    }
+
+    // Unlock, and wake a parked thread
+    if ( __atomic_exchange_n(&p_adaptive_mutex->_state, 0, __ATOMIC_RELEASE) == 2 ) sync_futex_wake(&p_adaptive_mutex->_state, 1);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_adaptive_mutex:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_adaptive_mutex\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int adaptive_mutex_destroy ( adaptive_mutex *p_adaptive_mutex )
+{
+
+    // Argument check
+    if ( p_adaptive_mutex == (void *) 0 ) goto no_adaptive_mutex;
+
+    // Error check
+    if ( __atomic_load_n(&p_adaptive_mutex->_state, __ATOMIC_ACQUIRE) != 0 ) goto mutex_locked;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_adaptive_mutex:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_adaptive_mutex\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Sync errors
+        {
+            mutex_locked:
+                #ifndef NDEBUG
+                    log_error("[sync] [mutex] Can not destroy a locked mutex in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+#endif
+#endif
+
+#ifdef BUILD_SYNC_WITH_SPINLOCK
+int spinlock_create ( spinlock *p_spinlock )
+{
+
+    // Argument check
+    if ( p_spinlock == (void *) 0 ) goto no_spinlock;
+
+    // Platform dependent implementation
+    #ifdef _WIN64
+    #else
+
+        // Clear the stats
+        #ifdef BUILD_SYNC_WITH_STATS
+            p_spinlock->_stats = (sync_stats) { 0 };
+        #endif
+
+        // Return
+        return ( pthread_spin_init(SYNC_NATIVE(p_spinlock, _spinlock), 0) == 0 );
+    #endif
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_spinlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_spinlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int spinlock_lock ( spinlock *p_spinlock )
+{
+
+    // Platform dependent implementation
+    #ifdef _WIN64
+    #else
+
+        // Lock
+        #ifdef BUILD_SYNC_WITH_STATS
+        {
+
+            // Initialized data
+            int ret = 0;
+
+            // Lock
+            SYNC_STATS_LOCK(p_spinlock, ret, pthread_spin_trylock(&p_spinlock->_spinlock), pthread_spin_lock(&p_spinlock->_spinlock));
+
+            // Store the time the spinlock was acquired
+            if ( ret ) p_spinlock->_acquired = timer_high_precision();
+
+            // Return
+            return ret;
+        }
+        #else
+
+            // Return
+            return ( pthread_spin_lock(p_spinlock) == 0 );
+        #endif
+    #endif
+
+    // Error handling
+    {
+
+        // Argument error
+        {
+            #ifdef _WIN64
+                no_spinlock:
+                    #ifndef NDEBUG
+                        log_error("[sync] Invalid parameter provided for \"_spinlock\" in call to function \"%s\"\n", __FUNCTION__);
+                    #endif
+
+                    // Error
+                    return 0;
+            #endif
+        }
+    }
+}
+
+int spinlock_unlock ( spinlock *p_spinlock )
+{
+
+    // Platform dependent implementation
+    #ifdef _WIN64
+    #else
+
+        // Record the hold
+        #ifdef BUILD_SYNC_WITH_STATS
+            sync_stats_release(&p_spinlock->_stats, p_spinlock->_acquired);
+        #endif
+
+        // Return
+        return ( pthread_spin_unlock(SYNC_NATIVE(p_spinlock, _spinlock)) == 0 );
+    #endif
+
+    // Error handling
+    {
+
+        // Argument error
+        {
+
+            #ifdef _WIN64
+                no_spinlock:
+                    #ifndef NDEBUG
+                        log_error("[sync] Invalid parameter provided for \"_spinlock\" in call to function \"%s\"\n", __FUNCTION__);
+                    #endif
+
+                    // Error
+                    return 0;
+            #endif
+        }
+    }
+}
+
+int spinlock_destroy ( spinlock *p_spinlock )
+{
+
+    // Argument check
+    if ( p_spinlock == (void *) 0 ) goto no_spinlock;
+
+    // Platform dependent implementation
+    #ifdef _WIN64
+    #else
+
+        // Return
+        return ( pthread_spin_destroy(SYNC_NATIVE(p_spinlock, _spinlock)) == 0 );
+    #endif
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_spinlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_spinlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int mcs_spinlock_create ( mcs_spinlock *p_mcs_spinlock )
+{
+
+    // Argument check
+    if ( p_mcs_spinlock == (void *) 0 ) goto no_mcs_spinlock;
+
+    // No waiters
+    __atomic_store_n(&p_mcs_spinlock->p_tail, (void *) 0, __ATOMIC_RELEASE);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_mcs_spinlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_mcs_spinlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int mcs_spinlock_lock ( mcs_spinlock *p_mcs_spinlock, mcs_node *p_mcs_node )
+{
+
+    // Argument check
+    if ( p_mcs_spinlock == (void *) 0 ) goto no_mcs_spinlock;
+    if ( p_mcs_node     == (void *) 0 ) goto no_mcs_node;
+
+    // Initialized data
+    mcs_node *p_predecessor = (void *) 0;
+    unsigned int spins = 0;
+
+    // Initialize the node
+    p_mcs_node->p_next = (void *) 0;
+    p_mcs_node->_locked = 1;
+
+    // Join the end of the queue
+    p_predecessor = __atomic_exchange_n(&p_mcs_spinlock->p_tail, p_mcs_node, __ATOMIC_ACQ_REL);
+
+    // The queue was empty, so the lock is owned
+    if ( p_predecessor == (void *) 0 ) return 1;
+
+    // Link the node to its predecessor
+    __atomic_store_n(&p_predecessor->p_next, p_mcs_node, __ATOMIC_RELEASE);
+
+    // Spin on the node until the predecessor hands the lock over
+    while ( __atomic_load_n(&p_mcs_node->_locked, __ATOMIC_ACQUIRE) ) sync_spin(&spins);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_mcs_spinlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_mcs_spinlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_mcs_node:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_mcs_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int mcs_spinlock_unlock ( mcs_spinlock *p_mcs_spinlock, mcs_node *p_mcs_node )
+{
+
+    // Argument check
+    if ( p_mcs_spinlock == (void *) 0 ) goto no_mcs_spinlock;
+    if ( p_mcs_node     == (void *) 0 ) goto no_mcs_node;
+
+    // Initialized data
+    mcs_node *p_successor = __atomic_load_n(&p_mcs_node->p_next, __ATOMIC_ACQUIRE),
+             *p_expected  = p_mcs_node;
+    unsigned int spins = 0;
+
+    // No known successor
+    if ( p_successor == (void *) 0 )
+    {
+
+        // If the node is still the end of the queue, the lock is free
+        if ( __atomic_compare_exchange_n(&p_mcs_spinlock->p_tail, &p_expected, (void *) 0, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED) ) return 1;
+
+        // A successor joined the queue, but hasn't linked itself yet
+        while ( ( p_successor = __atomic_load_n(&p_mcs_node->p_next, __ATOMIC_ACQUIRE) ) == (void *) 0 ) sync_spin(&spins);
+    }
+
+    // Hand the lock to the successor
+    __atomic_store_n(&p_successor->_locked, 0, __ATOMIC_RELEASE);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_mcs_spinlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_mcs_spinlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_mcs_node:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_mcs_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int mcs_spinlock_destroy ( mcs_spinlock *p_mcs_spinlock )
+{
+
+    // Argument check
+    if ( p_mcs_spinlock == (void *) 0 ) goto no_mcs_spinlock;
+
+    // Error check
+    if ( __atomic_load_n(&p_mcs_spinlock->p_tail, __ATOMIC_ACQUIRE) ) goto spinlock_locked;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_mcs_spinlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_mcs_spinlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Sync errors
+        {
+            spinlock_locked:
+                #ifndef NDEBUG
+                    log_error("[sync] [spinlock] Can not destroy a locked spinlock in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int ticket_spinlock_create ( ticket_spinlock *p_ticket_spinlock )
+{
+
+    // Argument check
+    if ( p_ticket_spinlock == (void *) 0 ) goto no_ticket_spinlock;
+
+    // No tickets have been taken
+    *p_ticket_spinlock = (ticket_spinlock) { 0 };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_ticket_spinlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_ticket_spinlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int ticket_spinlock_lock_slow ( ticket_spinlock *p_ticket_spinlock, uint32_t ticket )
+{
+
+    // Argument check
+    if ( p_ticket_spinlock == (void *) 0 ) goto no_ticket_spinlock;
+
+    // Initialized data
+    uint32_t owner = 0;
+    unsigned int spins = 0;
+
+    // Wait for the ticket to be served
+    while ( ( owner = __atomic_load_n(&p_ticket_spinlock->_owner, __ATOMIC_ACQUIRE) ) != ticket )
+    {
+
+        // Back off in proportion to the quantity of waiters ahead
+        for (uint32_t i = ( ticket - owner ) * 16; i; i--) sync_spin(&spins);
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_ticket_spinlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_ticket_spinlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int ticket_spinlock_destroy ( ticket_spinlock *p_ticket_spinlock )
+{
+
+    // Argument check
+    if ( p_ticket_spinlock == (void *) 0 ) goto no_ticket_spinlock;
+
+    // Error check
+    if ( __atomic_load_n(&p_ticket_spinlock->_next, __ATOMIC_ACQUIRE) != __atomic_load_n(&p_ticket_spinlock->_owner, __ATOMIC_ACQUIRE) ) goto spinlock_locked;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_ticket_spinlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_ticket_spinlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Sync errors
+        {
+            spinlock_locked:
+                #ifndef NDEBUG
+                    log_error("[sync] [spinlock] Can not destroy a locked spinlock in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int ttas_spinlock_create ( ttas_spinlock *p_ttas_spinlock )
+{
+
+    // Argument check
+    if ( p_ttas_spinlock == (void *) 0 ) goto no_ttas_spinlock;
+
+    // Unlocked
+    __atomic_store_n(&p_ttas_spinlock->_locked, 0, __ATOMIC_RELEASE);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_ttas_spinlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_ttas_spinlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int ttas_spinlock_lock_slow ( ttas_spinlock *p_ttas_spinlock )
+{
+
+    // Argument check
+    if ( p_ttas_spinlock == (void *) 0 ) goto no_ttas_spinlock;
+
+    // Initialized data
+    unsigned int backoff = 1, spins = 0;
+
+    for (;;)
+    {
+
+        // Test. Spin on a shared copy of the line, until the lock looks free
+        while ( __atomic_load_n(&p_ttas_spinlock->_locked, __ATOMIC_RELAXED) ) sync_spin(&spins);
+
+        // Test and set
+        if ( __atomic_exchange_n(&p_ttas_spinlock->_locked, 1, __ATOMIC_ACQUIRE) == 0 ) break;
+
+        // Another thread won the race. Back off, and double the next back off
+        for (unsigned int i = backoff; i; i--) sync_spin(&spins);
+        if ( backoff < SYNC_BACKOFF_MAX ) backoff *= 2;
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_ttas_spinlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_ttas_spinlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int ttas_spinlock_destroy ( ttas_spinlock *p_ttas_spinlock )
+{
+
+    // Argument check
+    if ( p_ttas_spinlock == (void *) 0 ) goto no_ttas_spinlock;
+
+    // Error check
+    if ( __atomic_load_n(&p_ttas_spinlock->_locked, __ATOMIC_ACQUIRE) ) goto spinlock_locked;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_ttas_spinlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_ttas_spinlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Sync errors
+        {
+            spinlock_locked:
+                #ifndef NDEBUG
+                    log_error("[sync] [spinlock] Can not destroy a locked spinlock in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+#endif
+
+#ifdef BUILD_SYNC_WITH_RW_LOCK
+/** !
+ * Check if a read-write lock can admit a reader, writer, or 
+ * upgradable reader. The caller must hold the lock's word.
+ * 
+ * @param p_rwlock the read-write lock
+ * @param mode     SYNC_RWLOCK_READ, SYNC_RWLOCK_WRITE, or SYNC_RWLOCK_UPGRADABLE
+ * @param phase    the writer phase when the caller arrived
+ * 
+ * @return true if the caller can lock, else false
+ */
+static bool rwlock_admit ( const rwlock *p_rwlock, int mode, uint32_t phase )
+{
+
+    // Writers need the lock to themselves, and wait for 
+    // readers that were admitted by the last writer 
+    if ( mode == SYNC_RWLOCK_WRITE ) return !p_rwlock->_writer && ( __atomic_load_n(&p_rwlock->_readers, __ATOMIC_ACQUIRE) & SYNC_RWLOCK_READERS ) == 0 && p_rwlock->_admit == 0;
+
+    // Readers wait for writers, and upgrades
+    if ( p_rwlock->_writer || p_rwlock->_upgrading ) return false;
+
+    // Only one upgradable reader at a time
+    if ( mode == SYNC_RWLOCK_UPGRADABLE && p_rwlock->_upgrader ) return false;
+
+    // Apply the policy
+    switch ( p_rwlock->_policy )
+    {
+        case SYNC_RWLOCK_PREFER_WRITER:
+            return p_rwlock->_writers_waiting == 0;
+
+        // Readers that queued behind the last writer go first
+        case SYNC_RWLOCK_PHASE_FAIR:
+            return p_rwlock->_writers_waiting == 0 || phase != p_rwlock->_phase;
+
+        default:
+            return true;
+    }
+}
+
+/** !
+ * Open or close the reader fast path. The fast path is closed while
+ * a writer holds the lock, an upgrade is pending, or writers wait,
+ * so readers that unlock tell the lock's word about it. The caller
+ * must hold the lock's word.
+ * 
+ * @param p_rwlock the read-write lock
+ * 
+ * @return void
+ */
+static void rwlock_update ( rwlock *p_rwlock )
+{
+
+    // Close the fast path
+    if ( p_rwlock->_writer || p_rwlock->_upgrading || p_rwlock->_writers_waiting ) 
+        __atomic_fetch_or(&p_rwlock->_readers, SYNC_RWLOCK_CLOSED, __ATOMIC_SEQ_CST);
+
+    // Open the fast path
+    else 
+        __atomic_fetch_and(&p_rwlock->_readers, SYNC_RWLOCK_READERS, __ATOMIC_RELEASE);
+
+    // Done
+    return;
+}
+
+/** !
+ * Lock a read-write lock for reading, without the lock's word
+ * 
+ * @param p_rwlock the read-write lock
+ * 
+ * @return true if the caller holds a read lock, else false
+ */
+static inline bool rwlock_read_fast ( rwlock *p_rwlock )
+{
+
+    // Initialized data
+    uint32_t readers = __atomic_load_n(&p_rwlock->_readers, __ATOMIC_RELAXED);
+
+    // Count the reader while the fast path is open
+    while ( ( readers & SYNC_RWLOCK_CLOSED ) == 0 )
+        if ( __atomic_compare_exchange_n(&p_rwlock->_readers, &readers, readers + 1, true, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) ) return true;
+
+    // Done
+    return false;
+}
+
+/** !
+ * Wake sleeping readers and writers. Call this after unlocking
+ * the lock's word.
+ * 
+ * @param p_rwlock the read-write lock
+ * @param readers  wake the readers
+ * @param writers  wake the writers
+ * 
+ * @return void
+ */
+static void rwlock_wake ( rwlock *p_rwlock, bool readers, bool writers )
+{
+
+    // Wake the readers
+    if ( readers ) sync_futex_wake(&p_rwlock->_readers_sequence, INT_MAX);
+
+    // Wake the writers, and the upgrader
+    if ( writers ) sync_futex_wake(&p_rwlock->_writers_sequence, INT_MAX);
+
+    // Done
+    return;
+}
+
+/** !
+ * Lock a read-write lock
+ * 
+ * @param p_rwlock the read-write lock
+ * @param mode     SYNC_RWLOCK_READ, SYNC_RWLOCK_WRITE, or SYNC_RWLOCK_UPGRADABLE
+ * @param _time    the quantity of time to wait, in nanoseconds. 0 to try, negative to wait indefinitely
+ * 
+ * @return 1 on success, 0 on timeout
+ */
+static int rwlock_acquire ( rwlock *p_rwlock, int mode, timestamp _time )
+{
+
+    // Initialized data
+    timestamp deadline = ( _time > 0 ) ? timer_monotonic_ns() + _time : 0;
+    uint32_t *p_sequence = ( mode == SYNC_RWLOCK_WRITE ) ? &p_rwlock->_writers_sequence : &p_rwlock->_readers_sequence;
+    uint32_t *p_waiting  = ( mode == SYNC_RWLOCK_WRITE ) ? &p_rwlock->_writers_waiting  : &p_rwlock->_readers_waiting;
+    uint32_t phase = 0;
+    bool waited = false, readers = false, writers = false;
+
+    // Fast path. Readers don't touch the lock's word while it is open
+    if ( mode == SYNC_RWLOCK_READ && rwlock_read_fast(p_rwlock) ) return 1;
+
+    // Lock
+    sync_word_lock(&p_rwlock->_lock);
+
+    // Store the writer phase
+    phase = p_rwlock->_phase;
+
+    // Writers close the fast path before they count the readers
+    if ( mode == SYNC_RWLOCK_WRITE ) __atomic_fetch_or(&p_rwlock->_readers, SYNC_RWLOCK_CLOSED, __ATOMIC_SEQ_CST);
+
+    // Wait for the lock to admit the caller
+    while ( rwlock_admit(p_rwlock, mode, phase) == false )
+    {
+
+        // Initialized data
+        uint32_t sequence = __atomic_load_n(p_sequence, __ATOMIC_RELAXED);
+        timestamp remaining = ( _time > 0 ) ? deadline - timer_monotonic_ns() : 0;
+
+        // Give up
+        if ( _time == 0 || ( _time > 0 && remaining <= 0 ) ) goto timeout;
+
+        // Count the waiter
+        if ( waited == false ) waited = true, (*p_waiting)++;
+
+        // Readers that wait for a writer don't change the fast path
+        if ( mode == SYNC_RWLOCK_WRITE ) rwlock_update(p_rwlock);
+
+        // Unlock
+        sync_word_unlock(&p_rwlock->_lock);
+
+        // Sleep until the lock changes
+        if ( _time < 0 ) sync_futex_wait(p_sequence, sequence);
+        else             sync_futex_wait_timeout(p_sequence, sequence, remaining);
+
+        // Lock
+        sync_word_lock(&p_rwlock->_lock);
+    }
+
+    // Stop waiting
+    if ( waited )
+    {
+        (*p_waiting)--;
+
+        // Admitted by the last writer
+        if ( mode != SYNC_RWLOCK_WRITE && phase != p_rwlock->_phase && p_rwlock->_admit ) p_rwlock->_admit--;
+    }
+
+    // Take the lock
+    if      ( mode == SYNC_RWLOCK_WRITE      ) p_rwlock->_writer = true;
+    else if ( mode == SYNC_RWLOCK_UPGRADABLE ) __atomic_fetch_add(&p_rwlock->_readers, 1, __ATOMIC_ACQUIRE), __atomic_store_n(&p_rwlock->_upgrader, sync_thread_index() + 1, __ATOMIC_RELAXED);
+    else                                       __atomic_fetch_add(&p_rwlock->_readers, 1, __ATOMIC_ACQUIRE);
+
+    // Open or close the fast path
+    rwlock_update(p_rwlock);
+
+    // Unlock
+    sync_word_unlock(&p_rwlock->_lock);
+
+    // Success
+    return 1;
+
+    // Timed out
+    timeout:
+    {
+
+        // Stop waiting
+        if ( waited )
+        {
+            (*p_waiting)--;
+
+            // Readers that gave up may hold back writers, and writers may hold back readers
+            if ( mode != SYNC_RWLOCK_WRITE && phase != p_rwlock->_phase && p_rwlock->_admit && --p_rwlock->_admit == 0 ) writers = true;
+            if ( mode == SYNC_RWLOCK_WRITE && p_rwlock->_writers_waiting == 0 && p_rwlock->_readers_waiting ) readers = true;
+        }
+
+        // Open or close the fast path
+        rwlock_update(p_rwlock);
+
+        // Announce the change
+        if ( readers ) __atomic_fetch_add(&p_rwlock->_readers_sequence, 1, __ATOMIC_RELAXED);
+        if ( writers ) __atomic_fetch_add(&p_rwlock->_writers_sequence, 1, __ATOMIC_RELAXED);
+
+        // Unlock
+        sync_word_unlock(&p_rwlock->_lock);
+
+        // Wake
+        rwlock_wake(p_rwlock, readers, writers);
+
+        // Error
+        return 0;
+    }
+}
+
+int rwlock_create ( rwlock *p_rwlock )
+{
+
+    // Prefer readers, like the platform's default
+    return rwlock_create_policy(p_rwlock, SYNC_RWLOCK_PREFER_READER);
+}
+
+int rwlock_create_policy ( rwlock *p_rwlock, rwlock_policy policy )
+{
+
+    // Argument check
+    if ( p_rwlock == (void *) 0 ) goto no_rwlock;
+    if ( (unsigned) policy >= SYNC_RWLOCK_POLICY_QUANTITY ) goto bad_policy;
+
+    // Unlocked
+    *p_rwlock = (rwlock) { ._policy = policy };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_rwlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_rwlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            bad_policy:
+                #ifndef NDEBUG
+                    log_error("[sync] Parameter \"policy\" must be less than %d in call to function \"%s\"\n", SYNC_RWLOCK_POLICY_QUANTITY, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int rwlock_lock_rd ( rwlock *p_rwlock )
+{
+
+    // Argument check
+    if ( p_rwlock == (void *) 0 ) goto no_rwlock;
+
+    // Lock
+    #ifdef BUILD_SYNC_WITH_STATS
+    {
+
+        // Initialized data
+        int ret = 0;
+
+        // Lock
+        SYNC_STATS_LOCK(p_rwlock, ret, !rwlock_acquire(p_rwlock, SYNC_RWLOCK_READ, 0), !rwlock_acquire(p_rwlock, SYNC_RWLOCK_READ, -1));
+
+        // Return
+        return ret;
+    }
+    #else
+
+        // Return
+        return rwlock_acquire(p_rwlock, SYNC_RWLOCK_READ, -1);
+    #endif
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_rwlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_rwlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int rwlock_lock_wr ( rwlock *p_rwlock )
+{
+
+    // Argument check
+    if ( p_rwlock == (void *) 0 ) goto no_rwlock;
+
+    // Lock
+    #ifdef BUILD_SYNC_WITH_STATS
+    {
+
+        // Initialized data
+        int ret = 0;
+
+        // Lock
+        SYNC_STATS_LOCK(p_rwlock, ret, !rwlock_acquire(p_rwlock, SYNC_RWLOCK_WRITE, 0), !rwlock_acquire(p_rwlock, SYNC_RWLOCK_WRITE, -1));
+
+        // Store the time the writer acquired the lock
+        if ( ret ) p_rwlock->_acquired = timer_high_precision();
+
+        // Return
+        return ret;
+    }
+    #else
+
+        // Return
+        return rwlock_acquire(p_rwlock, SYNC_RWLOCK_WRITE, -1);
+    #endif
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_rwlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_rwlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int rwlock_lock_timeout_rd ( rwlock *p_rwlock, timestamp _time )
+{
+
+    // Argument check
+    if ( p_rwlock == (void *) 0 ) goto no_rwlock;
+
+    // Don't wait indefinitely
+    if ( _time < 0 ) _time = 0;
+
+    // Lock
+    #ifdef BUILD_SYNC_WITH_STATS
+    {
+
+        // Initialized data
+        int ret = 0;
+
+        // Lock
+        SYNC_STATS_LOCK(p_rwlock, ret, !rwlock_acquire(p_rwlock, SYNC_RWLOCK_READ, 0), !rwlock_acquire(p_rwlock, SYNC_RWLOCK_READ, _time));
+
+        // Return
+        return ret;
+    }
+    #else
+
+        // Return
+        return rwlock_acquire(p_rwlock, SYNC_RWLOCK_READ, _time);
+    #endif
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_rwlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_rwlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int rwlock_lock_timeout_wr ( rwlock *p_rwlock, timestamp _time )
+{
+
+    // Argument check
+    if ( p_rwlock == (void *) 0 ) goto no_rwlock;
+
+    // Don't wait indefinitely
+    if ( _time < 0 ) _time = 0;
+
+    // Lock
+    #ifdef BUILD_SYNC_WITH_STATS
+    {
+
+        // Initialized data
+        int ret = 0;
+
+        // Lock
+        SYNC_STATS_LOCK(p_rwlock, ret, !rwlock_acquire(p_rwlock, SYNC_RWLOCK_WRITE, 0), !rwlock_acquire(p_rwlock, SYNC_RWLOCK_WRITE, _time));
+
+        // Store the time the writer acquired the lock
+        if ( ret ) p_rwlock->_acquired = timer_high_precision();
+
+        // Return
+        return ret;
+    }
+    #else
+
+        // Return
+        return rwlock_acquire(p_rwlock, SYNC_RWLOCK_WRITE, _time);
+    #endif
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_rwlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_rwlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int rwlock_lock_upgradable ( rwlock *p_rwlock )
+{
+
+    // Argument check
+    if ( p_rwlock == (void *) 0 ) goto no_rwlock;
+
+    // Lock
+    #ifdef BUILD_SYNC_WITH_STATS
+    {
+
+        // Initialized data
+        int ret = 0;
+
+        // Lock
+        SYNC_STATS_LOCK(p_rwlock, ret, !rwlock_acquire(p_rwlock, SYNC_RWLOCK_UPGRADABLE, 0), !rwlock_acquire(p_rwlock, SYNC_RWLOCK_UPGRADABLE, -1));
+
+        // Return
+        return ret;
+    }
+    #else
+
+        // Return
+        return rwlock_acquire(p_rwlock, SYNC_RWLOCK_UPGRADABLE, -1);
+    #endif
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_rwlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_rwlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int rwlock_upgrade ( rwlock *p_rwlock )
+{
+
+    // Argument check
+    if ( p_rwlock == (void *) 0 ) goto no_rwlock;
+
+    // Lock
+    sync_word_lock(&p_rwlock->_lock);
+
+    // State check
+    if ( __atomic_load_n(&p_rwlock->_upgrader, __ATOMIC_RELAXED) != sync_thread_index() + 1 ) goto not_upgradable;
+
+    // Hold new readers back
+    p_rwlock->_upgrading = true;
+    rwlock_update(p_rwlock);
+
+    // Wait for the other readers to unlock
+    while ( ( __atomic_load_n(&p_rwlock->_readers, __ATOMIC_ACQUIRE) & SYNC_RWLOCK_READERS ) != 1 )
+    {
+
+        // Initialized data
+        uint32_t sequence = __atomic_load_n(&p_rwlock->_writers_sequence, __ATOMIC_RELAXED);
+
+        // Unlock
+        sync_word_unlock(&p_rwlock->_lock);
+
+        // Sleep until a reader unlocks
+        sync_futex_wait(&p_rwlock->_writers_sequence, sequence);
+
+        // Lock
+        sync_word_lock(&p_rwlock->_lock);
+    }
+
+    // Become the writer
+    __atomic_fetch_sub(&p_rwlock->_readers, 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&p_rwlock->_upgrader, 0, __ATOMIC_RELAXED);
+    p_rwlock->_upgrading = false,
+    p_rwlock->_writer    = true;
+    rwlock_update(p_rwlock);
+
+    // Unlock
+    sync_word_unlock(&p_rwlock->_lock);
+
+    // Store the time the writer acquired the lock
+    #ifdef BUILD_SYNC_WITH_STATS
+        p_rwlock->_acquired = timer_high_precision();
+    #endif
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_rwlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_rwlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Sync errors
+        {
+            not_upgradable:
+
+                // Unlock
+                sync_word_unlock(&p_rwlock->_lock);
+
+                #ifndef NDEBUG
+                    log_error("[sync] Caller does not hold an upgradable read lock in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+/** !
+ * Release a writer. The caller must hold the lock's word.
+ * 
+ * @param p_rwlock  the read-write lock
+ * @param p_readers return true if readers must be woken
+ * @param p_writers return true if writers must be woken
+ * 
+ * @return void
+ */
+static void rwlock_release_writer ( rwlock *p_rwlock, bool *p_readers, bool *p_writers )
+{
+
+    // Record the hold of the writer
+    #ifdef BUILD_SYNC_WITH_STATS
+        sync_stats_release(&p_rwlock->_stats, p_rwlock->_acquired);
+    #endif
+
+    // Release the writer
+    p_rwlock->_writer = false;
+
+    // Start a new phase. The readers that queued behind the writer go next
+    p_rwlock->_phase++;
+    if ( p_rwlock->_policy == SYNC_RWLOCK_PHASE_FAIR ) p_rwlock->_admit = p_rwlock->_readers_waiting;
+
+    // Wake the waiters
+    *p_readers = p_rwlock->_readers_waiting != 0,
+    *p_writers = p_rwlock->_writers_waiting != 0;
+
+    // Done
+    return;
+}
+
+int rwlock_downgrade ( rwlock *p_rwlock )
+{
+
+    // Argument check
+    if ( p_rwlock == (void *) 0 ) goto no_rwlock;
+
+    // Initialized data
+    bool readers = false, writers = false;
+
+    // Lock
+    sync_word_lock(&p_rwlock->_lock);
+
+    // State check
+    if ( p_rwlock->_writer == false ) goto not_writer;
+
+    // Release the writer, and keep a reader
+    rwlock_release_writer(p_rwlock, &readers, &writers);
+    __atomic_fetch_add(&p_rwlock->_readers, 1, __ATOMIC_RELAXED);
+    rwlock_update(p_rwlock);
+
+    // Announce the change to readers. Writers still can't lock
+    if ( readers ) __atomic_fetch_add(&p_rwlock->_readers_sequence, 1, __ATOMIC_RELAXED);
+
+    // Unlock
+    sync_word_unlock(&p_rwlock->_lock);
+
+    // Wake the readers
+    rwlock_wake(p_rwlock, readers, false);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_rwlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_rwlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Sync errors
+        {
+            not_writer:
+
+                // Unlock
+                sync_word_unlock(&p_rwlock->_lock);
+
+                #ifndef NDEBUG
+                    log_error("[sync] Caller does not hold a write lock in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int rwlock_unlock ( rwlock *p_rwlock )
+{
+
+    // Argument check
+    if ( p_rwlock == (void *) 0 ) goto no_rwlock;
+
+    // Initialized data
+    bool readers = false, writers = false, released = false,
+         upgrader = __atomic_load_n(&p_rwlock->_upgrader, __ATOMIC_RELAXED) == sync_thread_index() + 1;
+    uint32_t count = 0;
+
+    // Fast path. Readers unlock without the lock's word while it is open. Writers 
+    // and the upgrader hold the lock's word, and there are no other readers under a writer
+    if ( upgrader == false && ( __atomic_load_n(&p_rwlock->_readers, __ATOMIC_RELAXED) & SYNC_RWLOCK_READERS ) )
+    {
+
+        // Release the reader
+        if ( ( __atomic_fetch_sub(&p_rwlock->_readers, 1, __ATOMIC_RELEASE) & SYNC_RWLOCK_CLOSED ) == 0 ) return 1;
+
+        // The fast path is closed. Someone may be waiting on this reader
+        released = true;
+    }
+
+    // Lock
+    sync_word_lock(&p_rwlock->_lock);
+
+    // Count the remaining readers
+    count = __atomic_load_n(&p_rwlock->_readers, __ATOMIC_ACQUIRE) & SYNC_RWLOCK_READERS;
+
+    // Wake a writer, or the upgrader
+    if ( released ) writers = ( count == 0 && p_rwlock->_writers_waiting ) || ( p_rwlock->_upgrading && count == 1 );
+
+    // Release a writer. Readers can't hold the lock at the same time
+    else if ( p_rwlock->_writer ) rwlock_release_writer(p_rwlock, &readers, &writers);
+
+    // Release the upgradable reader
+    else if ( upgrader )
+    {
+        count = __atomic_sub_fetch(&p_rwlock->_readers, 1, __ATOMIC_RELEASE) & SYNC_RWLOCK_READERS;
+        __atomic_store_n(&p_rwlock->_upgrader, 0, __ATOMIC_RELAXED);
+        readers = p_rwlock->_readers_waiting != 0;
+        writers = count == 0 && p_rwlock->_writers_waiting;
+    }
+
+    // Error
+    else goto not_locked;
+
+    // Open or close the fast path
+    rwlock_update(p_rwlock);
+
+    // Announce the change
+    if ( readers ) __atomic_fetch_add(&p_rwlock->_readers_sequence, 1, __ATOMIC_RELAXED);
+    if ( writers ) __atomic_fetch_add(&p_rwlock->_writers_sequence, 1, __ATOMIC_RELAXED);
+
+    // Unlock
+    sync_word_unlock(&p_rwlock->_lock);
+
+    // Wake
+    rwlock_wake(p_rwlock, readers, writers);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_rwlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_rwlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Sync errors
+        {
+            not_locked:
+
+                // Unlock
+                sync_word_unlock(&p_rwlock->_lock);
+
+                #ifndef NDEBUG
+                    log_error("[sync] Read-write lock is not locked in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int rwlock_destroy ( rwlock *p_rwlock )
+{
+
+    // Argument check
+    if ( p_rwlock == (void *) 0 ) goto no_rwlock;
+
+    // Error check
+    if ( p_rwlock->_writer || ( p_rwlock->_readers & SYNC_RWLOCK_READERS ) ) goto rwlock_locked;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_rwlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_rwlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Sync errors
+        {
+            rwlock_locked:
+                #ifndef NDEBUG
+                    log_error("[sync] Read-write lock destroyed while locked in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int brlock_create ( brlock *p_brlock )
+{
+
+    // Argument check
+    if ( p_brlock == (void *) 0 ) goto no_brlock;
+
+    // Initialized data
+    size_t slots = (size_t) sync_processors;
+    struct brlock_slot_s *p_slots = (void *) 0;
+
+    // Allocate a reader slot for each processor
+    if ( posix_memalign((void **)&p_slots, SYNC_CACHE_LINE, slots * sizeof(struct brlock_slot_s)) ) goto no_mem;
+
+    // Zero set
+    memset(p_slots, 0, slots * sizeof(struct brlock_slot_s));
+
+    // Populate the lock
+    *p_brlock = (brlock)
+    {
+        ._writer = 0,
+        ._slots  = slots,
+        .p_slots = p_slots
+    };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_brlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_brlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int brlock_lock_rd ( brlock *p_brlock )
+{
+
+    // Argument check
+    if ( p_brlock == (void *) 0 ) goto no_brlock;
+
+    // Initialized data
+    struct brlock_slot_s *p_slot = &((struct brlock_slot_s *)p_brlock->p_slots)[sync_thread_index() % p_brlock->_slots];
+
+    for (;;)
+    {
+
+        // Initialized data
+        uint32_t writer = 0;
+
+        // Announce the reader in its own slot
+        __atomic_fetch_add(&p_slot->readers, 1, __ATOMIC_SEQ_CST);
+
+        // No writer, so the lock is held
+        if ( __atomic_load_n(&p_brlock->_writer, __ATOMIC_SEQ_CST) == 0 ) break;
+
+        // Withdraw, so the writer can drain the slots
+        __atomic_fetch_sub(&p_slot->readers, 1, __ATOMIC_RELEASE);
+
+        // Sleep until the writer unlocks
+        while ( ( writer = __atomic_load_n(&p_brlock->_writer, __ATOMIC_ACQUIRE) ) != 0 )
+        {
+
+            // Tell the writer to wake the lock's waiters
+            if ( writer == 1 && !__atomic_compare_exchange_n(&p_brlock->_writer, &writer, 2, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ) continue;
+
+            // Sleep
+            sync_futex_wait(&p_brlock->_writer, 2);
+        }
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_brlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_brlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int brlock_unlock_rd ( brlock *p_brlock )
+{
+
+    // Argument check
+    if ( p_brlock == (void *) 0 ) goto no_brlock;
+
+    // Remove the reader from its slot
+    __atomic_fetch_sub(&((struct brlock_slot_s *)p_brlock->p_slots)[sync_thread_index() % p_brlock->_slots].readers, 1, __ATOMIC_RELEASE);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_brlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_brlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int brlock_lock_wr ( brlock *p_brlock )
+{
+
+    // Argument check
+    if ( p_brlock == (void *) 0 ) goto no_brlock;
+
+    // Initialized data
+    struct brlock_slot_s *p_slots = p_brlock->p_slots;
+    uint32_t expected = 0;
+    unsigned int spins = 0;
+
+    // Exclude other writers, and block new readers
+    if ( !__atomic_compare_exchange_n(&p_brlock->_writer, &expected, 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED) )
+        while ( __atomic_exchange_n(&p_brlock->_writer, 2, __ATOMIC_SEQ_CST) != 0 )
+            sync_futex_wait(&p_brlock->_writer, 2);
+
+    // Wait for the readers in every slot to drain
+    for (size_t i = 0; i < p_brlock->_slots; i++)
+        while ( __atomic_load_n(&p_slots[i].readers, __ATOMIC_ACQUIRE) ) sync_spin(&spins);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_brlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_brlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int brlock_unlock_wr ( brlock *p_brlock )
+{
+
+    // Argument check
+    if ( p_brlock == (void *) 0 ) goto no_brlock;
+
+    // Unlock, and wake every waiting reader and writer
+    if ( __atomic_exchange_n(&p_brlock->_writer, 0, __ATOMIC_RELEASE) == 2 ) sync_futex_wake(&p_brlock->_writer, INT_MAX);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_brlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_brlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int brlock_destroy ( brlock *p_brlock )
+{
+
+    // Argument check
+    if ( p_brlock == (void *) 0 ) goto no_brlock;
+
+    // Initialized data
+    struct brlock_slot_s *p_slots = p_brlock->p_slots;
+
+    // State check
+    if ( __atomic_load_n(&p_brlock->_writer, __ATOMIC_ACQUIRE) ) goto brlock_locked;
+    for (size_t i = 0; i < p_brlock->_slots; i++)
+        if ( __atomic_load_n(&p_slots[i].readers, __ATOMIC_ACQUIRE) ) goto brlock_locked;
+
+    // Free the reader slots
+    free(p_brlock->p_slots);
+
+    // Clear the lock
+    *p_brlock = (brlock) { 0 };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_brlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_brlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Sync errors
+        {
+            brlock_locked:
+                #ifndef NDEBUG
+                    log_error("[sync] Big reader lock destroyed while locked in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+#endif
+
+#ifdef BUILD_SYNC_WITH_SEQLOCK
+int seqlock_create ( seqlock *p_seqlock )
+{
+
+    // Argument check
+    if ( p_seqlock == (void *) 0 ) goto no_seqlock;
+
+    // No writes have happened
+    *p_seqlock = (seqlock) { 0 };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_seqlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_seqlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int seqlock_destroy ( seqlock *p_seqlock )
+{
+
+    // Argument check
+    if ( p_seqlock == (void *) 0 ) goto no_seqlock;
+
+    // Error check
+    if ( __atomic_load_n(&p_seqlock->_sequence, __ATOMIC_ACQUIRE) & 1 ) goto seqlock_writing;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_seqlock:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_seqlock\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Sync errors
+        {
+            seqlock_writing:
+                #ifndef NDEBUG
+                    log_error("[sync] Sequence lock destroyed during a write in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+#endif
+
+#ifdef BUILD_SYNC_WITH_RCU
+/** !
+ * Register the calling thread as a reader
+ * 
+ * @param void
+ * 
+ * @return the reader record of the calling thread on success, null pointer on error
+ */
+static struct rcu_thread_s *rcu_thread_register ( void )
+{
+
+    // Initialized data
+    struct rcu_thread_s *p_thread = (void *) 0;
+
+    // Allocate a reader record
+    if ( posix_memalign((void **)&p_thread, SYNC_CACHE_LINE, sizeof(struct rcu_thread_s)) ) goto no_mem;
+
+    // Zero set
+    memset(p_thread, 0, sizeof(struct rcu_thread_s));
+
+    // Add the record to the list of readers
+    sync_word_lock(&rcu_lock);
+    p_thread->p_next = p_rcu_threads;
+    __atomic_store_n(&p_rcu_threads, p_thread, __ATOMIC_RELEASE);
+    sync_word_unlock(&rcu_lock);
+
+    // Clean up the record when the thread exits
+    #ifdef _WIN64
+        FlsSetValue(rcu_key, p_thread);
+    #else
+        (void) pthread_setspecific(rcu_key, p_thread);
+    #endif
+
+    // Store the record
+    p_rcu_thread = p_thread;
+
+    // Success
+    return p_thread;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return (void *) 0;
+        }
+    }
+}
+
+/** !
+ * Wait for a grace period, then run a reader's deferred callbacks
+ * 
+ * @param p_thread the reader record
+ * 
+ * @return void
+ */
+static void rcu_thread_run ( struct rcu_thread_s *p_thread )
+{
+
+    // Initialized data
+    size_t count = p_thread->count;
+    struct rcu_callback_s *p_callbacks = p_thread->p_callbacks;
+
+    // Fast exit
+    if ( count == 0 ) return;
+
+    // Detach the batch, in case a callback defers another callback
+    p_thread->p_callbacks = (void *) 0,
+    p_thread->count       = 0,
+    p_thread->max         = 0;
+
+    // Wait for every reader that might hold a reference
+    (void) rcu_synchronize();
+
+    // Run each callback
+    for (size_t i = 0; i < count; i++) p_callbacks[i].pfn_rcu_callback(p_callbacks[i].p_value);
+
+    // Reuse the batch
+    if ( p_thread->p_callbacks == (void *) 0 ) p_thread->p_callbacks = p_callbacks, p_thread->max = SYNC_RCU_BATCH;
+    else free(p_callbacks);
+
+    // Done
+    return;
+}
+
+/** !
+ * Run a reader's deferred callbacks, and free its record. This 
+ * gets called when a reader thread exits.
+ * 
+ * @param p_thread_record the reader record
+ * 
+ * @return void
+ */
+static void rcu_thread_exit ( void *p_thread_record )
+{
+
+    // Initialized data
+    struct rcu_thread_s *p_thread = p_thread_record;
+
+    // Run the deferred callbacks
+    while ( p_thread->count ) rcu_thread_run(p_thread);
+
+    // Remove the record from the list of readers
+    sync_word_lock(&rcu_lock);
+    for (struct rcu_thread_s **pp_iter = &p_rcu_threads; *pp_iter; pp_iter = &(*pp_iter)->p_next)
+        if ( *pp_iter == p_thread ) { *pp_iter = p_thread->p_next; break; }
+    sync_word_unlock(&rcu_lock);
+
+    // Clear the record
+    #ifdef _WIN64
+        FlsSetValue(rcu_key, (void *) 0);
+    #else
+        (void) pthread_setspecific(rcu_key, (void *) 0);
+    #endif
+    p_rcu_thread = (void *) 0;
+
+    // Free the record
+    free(p_thread->p_callbacks);
+    free(p_thread);
+
+    // Done
+    return;
+}
+
+int rcu_read_lock ( void )
+{
+
+    // Initialized data
+    struct rcu_thread_s *p_thread = p_rcu_thread;
+
+    // Register the calling thread
+    if ( p_thread == (void *) 0 && ( p_thread = rcu_thread_register() ) == (void *) 0 ) goto failed_to_register;
+
+    // Nested critical section
+    if ( p_thread->nest++ ) return 1;
+
+    // Announce the reader
+    __atomic_store_n(&p_thread->epoch, __atomic_load_n(&rcu_epoch, __ATOMIC_ACQUIRE), __ATOMIC_RELAXED);
+
+    // Order the announcement before the reads. Grace periods 
+    // issue this fence on the reader's behalf, if they can
+    if ( rcu_membarrier ) __atomic_signal_fence(__ATOMIC_SEQ_CST);
+    else                  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Sync errors
+        {
+            failed_to_register:
+                #ifndef NDEBUG
+                    log_error("[sync] Failed to register reader in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int rcu_read_unlock ( void )
+{
+
+    // Initialized data
+    struct rcu_thread_s *p_thread = p_rcu_thread;
+
+    // State check
+    if ( p_thread == (void *) 0 || p_thread->nest == 0 ) goto not_reading;
+
+    // Leave the outermost critical section
+    if ( --p_thread->nest == 0 ) __atomic_store_n(&p_thread->epoch, 0, __ATOMIC_RELEASE);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Sync errors
+        {
+            not_reading:
+                #ifndef NDEBUG
+                    log_error("[sync] Unlock outside of a read side critical section in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int rcu_synchronize ( void )
+{
+
+    // Initialized data
+    uint64_t epoch = 0;
+    unsigned int spins = 0;
+
+    // State check
+    if ( p_rcu_thread && p_rcu_thread->nest ) goto reading;
+
+    // One grace period at a time
+    sync_word_lock(&rcu_lock);
+
+    // Start a new epoch. Readers that start after this can't see removed data
+    epoch = __atomic_add_fetch(&rcu_epoch, 1, __ATOMIC_SEQ_CST);
+
+    // Fence every running reader
+    #if defined(__linux__) && defined(SYS_membarrier)
+        if ( rcu_membarrier ) (void) syscall(SYS_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0, 0);
+    #endif
+
+    // Wait for each reader in an older epoch
+    for (struct rcu_thread_s *p_thread = p_rcu_threads; p_thread; p_thread = p_thread->p_next)
+    {
+
+        // Initialized data
+        uint64_t reader = 0;
+
+        // Wait for the reader to leave its critical section
+        while ( ( reader = __atomic_load_n(&p_thread->epoch, __ATOMIC_ACQUIRE) ) != 0 && reader < epoch ) sync_spin(&spins);
+    }
+
+    // Done
+    sync_word_unlock(&rcu_lock);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Sync errors
+        {
+            reading:
+                #ifndef NDEBUG
+                    log_error("[sync] Grace period requested from a read side critical section in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int rcu_call ( fn_rcu_callback *pfn_rcu_callback, void *p_value )
+{
+
+    // Argument check
+    if ( pfn_rcu_callback == (void *) 0 ) goto no_rcu_callback;
+
+    // Initialized data
+    struct rcu_thread_s *p_thread = p_rcu_thread;
+
+    // Register the calling thread
+    if ( p_thread == (void *) 0 && ( p_thread = rcu_thread_register() ) == (void *) 0 ) goto failed_to_register;
+
+    // Grow the batch. It only outgrows the threshold inside a critical section
+    if ( p_thread->count == p_thread->max )
+    {
+
+        // Initialized data
+        size_t max = p_thread->max ? p_thread->max * 2 : SYNC_RCU_BATCH;
+        struct rcu_callback_s *p_callbacks = realloc(p_thread->p_callbacks, max * sizeof(struct rcu_callback_s));
+
+        // Error check
+        if ( p_callbacks == (void *) 0 ) goto no_mem;
+
+        // Update the batch
+        p_thread->p_callbacks = p_callbacks,
+        p_thread->max         = max;
+    }
+
+    // Defer the callback
+    p_thread->p_callbacks[p_thread->count].pfn_rcu_callback = pfn_rcu_callback,
+    p_thread->p_callbacks[p_thread->count].p_value          = p_value,
+    p_thread->count++;
+
+    // Run a full batch, outside of a critical section
+    if ( p_thread->count >= SYNC_RCU_BATCH && p_thread->nest == 0 ) rcu_thread_run(p_thread);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_rcu_callback:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"pfn_rcu_callback\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Sync errors
+        {
+            failed_to_register:
+                #ifndef NDEBUG
+                    log_error("[sync] Failed to register reader in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int rcu_barrier ( void )
+{
+
+    // State check
+    if ( p_rcu_thread && p_rcu_thread->nest ) goto reading;
+
+    // Run the deferred callbacks
+    while ( p_rcu_thread && p_rcu_thread->count ) rcu_thread_run(p_rcu_thread);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Sync errors
+        {
+            reading:
+                #ifndef NDEBUG
+                    log_error("[sync] Barrier requested from a read side critical section in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+#endif
+
+#ifdef BUILD_SYNC_WITH_HAZARD_POINTER
+/** !
+ * Acquire hazard slots for the calling thread. Records of exited
+ * threads are reused, so the quantity of records is bounded by the 
+ * peak quantity of threads.
+ * 
+ * @param void
+ * 
+ * @return the hazard record of the calling thread on success, null pointer on error
+ */
+static struct hazptr_thread_s *hazptr_thread_acquire ( void )
+{
+
+    // Initialized data
+    struct hazptr_thread_s *p_thread = (void *) 0;
+
+    // Reuse the record of an exited thread
+    for (p_thread = __atomic_load_n(&p_hazptr_threads, __ATOMIC_ACQUIRE); p_thread; p_thread = p_thread->p_next)
+    {
+
+        // Initialized data
+        uint32_t expected = 0;
+
+        // Claim the record
+        if ( __atomic_load_n(&p_thread->active, __ATOMIC_RELAXED) == 0 && __atomic_compare_exchange_n(&p_thread->active, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) ) goto done;
+    }
+
+    // Allocate a hazard record
+    if ( posix_memalign((void **)&p_thread, SYNC_CACHE_LINE, sizeof(struct hazptr_thread_s)) ) goto no_mem;
+
+    // Zero set
+    memset(p_thread, 0, sizeof(struct hazptr_thread_s));
+
+    // Claim the record
+    p_thread->active = 1;
+
+    // Add the record to the list of records
+    p_thread->p_next = __atomic_load_n(&p_hazptr_threads, __ATOMIC_RELAXED);
+    while ( !__atomic_compare_exchange_n(&p_hazptr_threads, &p_thread->p_next, p_thread, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED) );
+    __atomic_fetch_add(&hazptr_threads, 1, __ATOMIC_RELAXED);
+
+    done:
+
+    // Release the record when the thread exits
+    #ifdef _WIN64
+        FlsSetValue(hazptr_key, p_thread);
+    #else
+        (void) pthread_setspecific(hazptr_key, p_thread);
+    #endif
+
+    // Store the record
+    p_hazptr_thread = p_thread;
+
+    // Success
+    return p_thread;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return (void *) 0;
+        }
+    }
+}
+
+/** !
+ * Order two pointers
+ * 
+ * @param p_a pointer to the first pointer
+ * @param p_b pointer to the second pointer
+ * 
+ * @return -1 if a < b, 1 if a > b, else 0
+ */
+static int hazptr_compare ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    uintptr_t a = (uintptr_t) *(void *const *)p_a,
+              b = (uintptr_t) *(void *const *)p_b;
+
+    // Done
+    return ( a > b ) - ( a < b );
+}
+
+/** !
+ * Reclaim each retired pointer of a thread that is not protected
+ * 
+ * @param p_thread the hazard record
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int hazptr_thread_scan ( struct hazptr_thread_s *p_thread )
+{
+
+    // Initialized data
+    struct hazptr_thread_s *p_threads = __atomic_load_n(&p_hazptr_threads, __ATOMIC_ACQUIRE);
+    void **p_hazards = (void *) 0;
+    size_t hazards = 0, count = 0, kept = 0;
+
+    // Adopt the retired pointers of exited threads
+    if ( __atomic_load_n(&hazptr_orphans, __ATOMIC_RELAXED) )
+    {
+
+        // Initialized data
+        struct hazptr_retired_s *p_retired = (void *) 0;
+
+        // Lock
+        sync_word_lock(&hazptr_lock);
+
+        // Take the orphans
+        if ( hazptr_orphans )
+        {
+
+            // Make room for the orphans
+            p_retired = realloc(p_thread->p_retired, ( p_thread->count + hazptr_orphans ) * sizeof(struct hazptr_retired_s));
+
+            // Error check
+            if ( p_retired == (void *) 0 ) 
+            {
+                sync_word_unlock(&hazptr_lock);
+                goto no_mem;
+            }
+
+            // Append
+            memcpy(&p_retired[p_thread->count], p_hazptr_orphans, hazptr_orphans * sizeof(struct hazptr_retired_s));
+            p_thread->p_retired = p_retired,
+            p_thread->count    += hazptr_orphans,
+            p_thread->max       = p_thread->count;
+
+            // Clear the orphans
+            free(p_hazptr_orphans);
+            p_hazptr_orphans = (void *) 0;
+            __atomic_store_n(&hazptr_orphans, 0, __ATOMIC_RELAXED);
+        }
+
+        // Unlock
+        sync_word_unlock(&hazptr_lock);
+    }
+
+    // Fast exit
+    if ( p_thread->count == 0 || p_thread->scanning ) return 1;
+
+    // Order the retirements before reading the hazard slots
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    // Count the hazard records. New records are added to the head
+    // of the list, and can't protect pointers that were retired
+    for (struct hazptr_thread_s *p_iter = p_threads; p_iter; p_iter = p_iter->p_next) hazards += SYNC_HAZPTR_SLOTS;
+
+    // Allocate memory for the hazards
+    p_hazards = malloc(hazards * sizeof(void *));
+
+    // Error check
+    if ( p_hazards == (void *) 0 ) goto no_mem;
+
+    // Collect the hazards
+    hazards = 0;
+    for (struct hazptr_thread_s *p_iter = p_threads; p_iter; p_iter = p_iter->p_next)
+        for (size_t i = 0; i < SYNC_HAZPTR_SLOTS; i++)
+            if ( ( p_hazards[hazards] = __atomic_load_n(&p_iter->slots[i], __ATOMIC_ACQUIRE) ) ) hazards++;
+
+    // Sort the hazards
+    qsort(p_hazards, hazards, sizeof(void *), hazptr_compare);
+
+    // Move the protected pointers to the front
+    count = p_thread->count;
+    for (size_t i = 0; i < count; i++)
+    {
+
+        // Initialized data
+        struct hazptr_retired_s retired = p_thread->p_retired[i];
+
+        // Skip pointers that are not protected
+        if ( hazards == 0 || bsearch(&retired.p_value, p_hazards, hazards, sizeof(void *), hazptr_compare) == (void *) 0 ) continue;
+
+        // Swap
+        p_thread->p_retired[i] = p_thread->p_retired[kept],
+        p_thread->p_retired[kept++] = retired;
+    }
+
+    // Clean up
+    free(p_hazards);
+
+    // Reclaim the rest. Reclaim functions may retire more pointers,
+    // which are appended, so the list is indexed on each iteration
+    p_thread->scanning = true;
+    for (size_t i = kept; i < count; i++) p_thread->p_retired[i].pfn_hazptr_reclaim(p_thread->p_retired[i].p_value);
+    p_thread->scanning = false;
+
+    // Move the pointers that were retired during the scan down
+    memmove(&p_thread->p_retired[kept], &p_thread->p_retired[count], ( p_thread->count - count ) * sizeof(struct hazptr_retired_s));
+    p_thread->count -= count - kept;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+/** !
+ * Reclaim what can be reclaimed, hand the rest to the next scan, 
+ * and release the hazard record. This gets called when a thread 
+ * exits.
+ * 
+ * @param p_thread_record the hazard record
+ * 
+ * @return void
+ */
+static void hazptr_thread_exit ( void *p_thread_record )
+{
+
+    // Initialized data
+    struct hazptr_thread_s *p_thread = p_thread_record;
+
+    // Drop the thread's hazards
+    for (size_t i = 0; i < SYNC_HAZPTR_SLOTS; i++) __atomic_store_n(&p_thread->slots[i], (void *) 0, __ATOMIC_RELEASE);
+
+    // Reclaim
+    (void) hazptr_thread_scan(p_thread);
+
+    // Orphan the protected pointers
+    if ( p_thread->count )
+    {
+
+        // Initialized data
+        struct hazptr_retired_s *p_orphans = (void *) 0;
+
+        // Lock
+        sync_word_lock(&hazptr_lock);
+
+        // Make room for the thread's retired pointers
+        p_orphans = realloc(p_hazptr_orphans, ( hazptr_orphans + p_thread->count ) * sizeof(struct hazptr_retired_s));
+
+        // Append. If memory is short, the pointers leak rather than being reclaimed early
+        if ( p_orphans )
+        {
+            memcpy(&p_orphans[hazptr_orphans], p_thread->p_retired, p_thread->count * sizeof(struct hazptr_retired_s));
+            p_hazptr_orphans = p_orphans;
+            __atomic_store_n(&hazptr_orphans, hazptr_orphans + p_thread->count, __ATOMIC_RELAXED);
+        }
+
+        // Unlock
+        sync_word_unlock(&hazptr_lock);
+    }
+
+    // Free the retired pointers
+    free(p_thread->p_retired);
+    p_thread->p_retired = (void *) 0, p_thread->count = 0, p_thread->max = 0;
+
+    // Clear the record
+    #ifdef _WIN64
+        FlsSetValue(hazptr_key, (void *) 0);
+    #else
+        (void) pthread_setspecific(hazptr_key, (void *) 0);
+    #endif
+    p_hazptr_thread = (void *) 0;
+
+    // Release the record for reuse
+    __atomic_store_n(&p_thread->active, 0, __ATOMIC_RELEASE);
+
+    // Done
+    return;
+}
+
+void *hazptr_protect ( void *const *pp_source, size_t index )
+{
+
+    // Argument check
+    if ( pp_source == (void *) 0 ) goto no_source;
+    if ( index >= SYNC_HAZPTR_SLOTS ) goto bad_index;
+
+    // Initialized data
+    struct hazptr_thread_s *p_thread = p_hazptr_thread;
+    void *p_value = (void *) 0, *p_check = (void *) 0;
+
+    // Acquire hazard slots for the calling thread
+    if ( p_thread == (void *) 0 && ( p_thread = hazptr_thread_acquire() ) == (void *) 0 ) goto failed_to_acquire;
+
+    // Load the pointer
+    p_value = __atomic_load_n(pp_source, __ATOMIC_ACQUIRE);
+
+    for (;;)
+    {
+
+        // Publish the hazard
+        __atomic_store_n(&p_thread->slots[index], p_value, __ATOMIC_RELAXED);
+
+        // Order the hazard before the check
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+        // If the pointer is unchanged, it hasn't been retired
+        if ( ( p_check = __atomic_load_n(pp_source, __ATOMIC_ACQUIRE) ) == p_value ) break;
+
+        // Try again
+        p_value = p_check;
+    }
+
+    // Success
+    return p_value;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_source:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"pp_source\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return (void *) 0;
+
+            bad_index:
+                #ifndef NDEBUG
+                    log_error("[sync] Parameter \"index\" must be less than %d in call to function \"%s\"\n", SYNC_HAZPTR_SLOTS, __FUNCTION__);
+                #endif
+
+                // Error
+                return (void *) 0;
+        }
+
+        // Sync errors
+        {
+            failed_to_acquire:
+                #ifndef NDEBUG
+                    log_error("[sync] Failed to acquire hazard slots in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return (void *) 0;
+        }
+    }
+}
+
+int hazptr_clear ( size_t index )
+{
+
+    // Argument check
+    if ( index >= SYNC_HAZPTR_SLOTS ) goto bad_index;
+
+    // Clear the hazard
+    if ( p_hazptr_thread ) __atomic_store_n(&p_hazptr_thread->slots[index], (void *) 0, __ATOMIC_RELEASE);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            bad_index:
+                #ifndef NDEBUG
+                    log_error("[sync] Parameter \"index\" must be less than %d in call to function \"%s\"\n", SYNC_HAZPTR_SLOTS, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int hazptr_retire ( void *p_value, fn_hazptr_reclaim *pfn_hazptr_reclaim )
+{
+
+    // Argument check
+    if ( p_value            == (void *) 0 ) goto no_value;
+    if ( pfn_hazptr_reclaim == (void *) 0 ) goto no_hazptr_reclaim;
+
+    // Initialized data
+    struct hazptr_thread_s *p_thread = p_hazptr_thread;
+    size_t threshold = 2 * SYNC_HAZPTR_SLOTS * __atomic_load_n(&hazptr_threads, __ATOMIC_RELAXED);
+
+    // Acquire hazard slots for the calling thread
+    if ( p_thread == (void *) 0 && ( p_thread = hazptr_thread_acquire() ) == (void *) 0 ) goto failed_to_acquire;
+
+    // Grow the retired pointers
+    if ( p_thread->count == p_thread->max )
+    {
+
+        // Initialized data
+        size_t max = p_thread->max ? p_thread->max * 2 : SYNC_HAZPTR_SCAN_MIN;
+        struct hazptr_retired_s *p_retired = realloc(p_thread->p_retired, max * sizeof(struct hazptr_retired_s));
+
+        // Error check
+        if ( p_retired == (void *) 0 ) goto no_mem;
+
+        // Update the retired pointers
+        p_thread->p_retired = p_retired,
+        p_thread->max       = max;
+    }
+
+    // Retire the pointer
+    p_thread->p_retired[p_thread->count].p_value            = p_value,
+    p_thread->p_retired[p_thread->count].pfn_hazptr_reclaim = pfn_hazptr_reclaim,
+    p_thread->count++;
+
+    // Scan once the retired pointers outnumber the hazards. At least
+    // half of them are reclaimed, so the cost of a scan is amortized
+    if ( p_thread->count >= ( threshold > SYNC_HAZPTR_SCAN_MIN ? threshold : SYNC_HAZPTR_SCAN_MIN ) ) (void) hazptr_thread_scan(p_thread);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_value:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_hazptr_reclaim:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"pfn_hazptr_reclaim\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Sync errors
+        {
+            failed_to_acquire:
+                #ifndef NDEBUG
+                    log_error("[sync] Failed to acquire hazard slots in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int hazptr_scan ( void )
+{
+
+    // Reclaim
+    return p_hazptr_thread ? hazptr_thread_scan(p_hazptr_thread) : 1;
+}
+#endif
+
+#ifdef BUILD_SYNC_WITH_SEMAPHORE
+/** !
+ * Take units from a semaphore, without waiting
+ * 
+ * @param p_semaphore the semaphore
+ * @param n           the quantity of units
+ * 
+ * @return true if the units were taken, else false
+ */
+static inline bool semaphore_try ( semaphore *p_semaphore, uint32_t n )
+{
+
+    // Initialized data
+    uint32_t count = __atomic_load_n(&p_semaphore->_count, __ATOMIC_RELAXED);
+
+    // Take the units, if there are enough
+    while ( count >= n )
+        if ( __atomic_compare_exchange_n(&p_semaphore->_count, &count, count - n, true, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) ) return true;
+
+    // Done
+    return false;
+}
+
+/** !
+ * Take units from a semaphore, spinning briefly, then sleeping
+ * 
+ * @param p_semaphore the semaphore
+ * @param n           the quantity of units
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int semaphore_wait_slow ( semaphore *p_semaphore, uint32_t n )
+{
+
+    // Spin briefly. A signal is often a few instructions away
+    if ( sync_processors > 1 )
+        for (unsigned int i = 0; i < SYNC_SEMAPHORE_SPIN; i++)
+        {
+
+            // Spin
+            sync_pause();
+
+            // Try
+            if ( semaphore_try(p_semaphore, n) ) return 1;
+        }
+
+    // Announce the waiter
+    __atomic_fetch_add(&p_semaphore->_waiters, 1, __ATOMIC_SEQ_CST);
+    if ( n > 1 ) __atomic_fetch_add(&p_semaphore->_batch_waiters, 1, __ATOMIC_SEQ_CST);
+
+    for (;;)
+    {
+
+        // Initialized data
+        uint32_t count = __atomic_load_n(&p_semaphore->_count, __ATOMIC_SEQ_CST);
+
+        // Try
+        if ( count >= n && semaphore_try(p_semaphore, n) ) break;
+
+        // Sleep until the count changes
+        if ( count < n ) sync_futex_wait(&p_semaphore->_count, count);
+    }
+
+    // Withdraw the waiter
+    if ( n > 1 ) __atomic_fetch_sub(&p_semaphore->_batch_waiters, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_sub(&p_semaphore->_waiters, 1, __ATOMIC_RELAXED);
+
+    // Success
+    return 1;
+}
+
+int semaphore_create ( semaphore *p_semaphore, unsigned int count )
+{
+
+    // Argument check
+    if ( p_semaphore == (void *) 0 ) goto no_semaphore;
+
+    // Store the count, and clear the stats
+    *p_semaphore = (semaphore) { ._count = count };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_semaphore:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_semaphore\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int semaphore_wait ( semaphore *p_semaphore )
+{
+
+    // Take one unit
+    return semaphore_wait_n(p_semaphore, 1);
+}
+
+int semaphore_wait_n ( semaphore *p_semaphore, unsigned int n )
+{
+
+    // Argument check
+    if ( p_semaphore == (void *) 0 ) goto no_semaphore;
+
+    // Wait
+    #ifdef BUILD_SYNC_WITH_STATS
+    {
+
+        // Initialized data
+        int ret = 0;
+
+        // Wait
+        SYNC_STATS_LOCK(p_semaphore, ret, !semaphore_try(p_semaphore, n), !semaphore_wait_slow(p_semaphore, n));
+
+        // Return
+        return ret;
+    }
+    #else
+
+        // Fast path
+        if ( semaphore_try(p_semaphore, n) ) return 1;
+
+        // Slow path
+        return semaphore_wait_slow(p_semaphore, n);
+    #endif
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_semaphore:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_semaphore\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int semaphore_signal ( semaphore *p_semaphore )
+{
+
+    // Add one unit
+    return semaphore_signal_n(p_semaphore, 1);
+}
+
+int semaphore_signal_n ( semaphore *p_semaphore, unsigned int n )
+{
+
+    // Argument check
+    if ( p_semaphore == (void *) 0 ) goto no_semaphore;
+
+    // Fast exit
+    if ( n == 0 ) return 1;
+
+    // Add the units
+    __atomic_fetch_add(&p_semaphore->_count, n, __ATOMIC_SEQ_CST);
+
+    // Wake the waiters. A waiter for many units might not be 
+    // satisfied, so it can't be trusted to pass the wake along
+    if ( __atomic_load_n(&p_semaphore->_waiters, __ATOMIC_SEQ_CST) )
+        sync_futex_wake(&p_semaphore->_count, __atomic_load_n(&p_semaphore->_batch_waiters, __ATOMIC_RELAXED) ? INT_MAX : (int) ( n < INT_MAX ? n : INT_MAX ));
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_semaphore:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_semaphore\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int semaphore_destroy ( semaphore *p_semaphore )
+{
+
+    // Argument check
+    if ( p_semaphore == (void *) 0 ) goto no_semaphore;
+
+    // Error check
+    if ( __atomic_load_n(&p_semaphore->_waiters, __ATOMIC_ACQUIRE) ) goto semaphore_waited;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_semaphore:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_semaphore\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Sync errors
+        {
+            semaphore_waited:
+                #ifndef NDEBUG
+                    log_error("[sync] Semaphore destroyed with waiters in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int wsem_create ( wsem *p_wsem, uint64_t permits )
+{
+
+    // Argument check
+    if ( p_wsem == (void *) 0 ) goto no_wsem;
+
+    // Store the permits
+    *p_wsem = (wsem)
+    {
+        ._available = permits,
+        ._capacity  = permits
+    };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_wsem:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_wsem\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int wsem_acquire ( wsem *p_wsem, uint64_t permits )
+{
+
+    // Argument check
+    if ( p_wsem == (void *) 0 ) goto no_wsem;
+
+    // Initialized data
+    struct wsem_waiter_s waiter = { .permits = permits };
+    unsigned int spins = 0;
+
+    // Lock
+    sync_word_lock(&p_wsem->_lock);
+
+    // Error check
+    if ( permits > p_wsem->_capacity ) goto too_many_permits;
+
+    // Fast path. Don't pass the waiters
+    if ( p_wsem->p_head == (void *) 0 && p_wsem->_available >= permits )
+    {
+
+        // Take the permits
+        p_wsem->_available -= permits;
+
+        // Unlock
+        sync_word_unlock(&p_wsem->_lock);
+
+        // Success
+        return 1;
+    }
+
+    // Join the queue
+    if ( p_wsem->p_tail ) ((struct wsem_waiter_s *)p_wsem->p_tail)->p_next = &waiter;
+    else                  p_wsem->p_head = &waiter;
+    p_wsem->p_tail = &waiter;
+
+    // Unlock
+    sync_word_unlock(&p_wsem->_lock);
+
+    // Spin briefly, then sleep until the permits are granted
+    while ( __atomic_load_n(&waiter.granted, __ATOMIC_ACQUIRE) == 0 )
+    {
+        if ( sync_processors > 1 && spins < SYNC_SEMAPHORE_SPIN ) sync_pause(), spins++;
+        else                                                      sync_futex_wait(&waiter.granted, 0);
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_wsem:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_wsem\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            too_many_permits:
+
+                // Unlock
+                sync_word_unlock(&p_wsem->_lock);
+
+                #ifndef NDEBUG
+                    log_error("[sync] Parameter \"permits\" exceeds the capacity of the weighted semaphore in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int wsem_try_acquire ( wsem *p_wsem, uint64_t permits )
+{
+
+    // Argument check
+    if ( p_wsem == (void *) 0 ) goto no_wsem;
+
+    // Initialized data
+    int ret = 0;
+
+    // Lock
+    sync_word_lock(&p_wsem->_lock);
+
+    // Take the permits, if nobody is waiting for them
+    if ( p_wsem->p_head == (void *) 0 && p_wsem->_available >= permits ) p_wsem->_available -= permits, ret = 1;
+
+    // Unlock
+    sync_word_unlock(&p_wsem->_lock);
+
+    // Done
+    return ret;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_wsem:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_wsem\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int wsem_release ( wsem *p_wsem, uint64_t permits )
+{
+
+    // Argument check
+    if ( p_wsem == (void *) 0 ) goto no_wsem;
+
+    // Initialized data
+    struct wsem_waiter_s *p_granted = (void *) 0;
+
+    // Lock
+    sync_word_lock(&p_wsem->_lock);
+
+    // Error check. Only permits that were acquired can be released
+    if ( permits > p_wsem->_capacity - p_wsem->_available ) goto too_many_permits;
+
+    // Return the permits
+    p_wsem->_available += permits;
+
+    // Grant permits to the head of the queue, in order
+    while ( p_wsem->p_head && ((struct wsem_waiter_s *)p_wsem->p_head)->permits <= p_wsem->_available )
+    {
+
+        // Initialized data
+        struct wsem_waiter_s *p_waiter = p_wsem->p_head;
+
+        // Take the permits on behalf of the waiter
+        p_wsem->_available -= p_waiter->permits;
+
+        // Dequeue the waiter
+        p_wsem->p_head = p_waiter->p_next;
+        if ( p_wsem->p_head == (void *) 0 ) p_wsem->p_tail = (void *) 0;
+
+        // Remember the waiter
+        if ( p_granted == (void *) 0 ) p_granted = p_waiter;
+    }
+
+    // Detach the granted waiters from the rest of the queue
+    if ( p_granted && p_wsem->p_head )
+        for (struct wsem_waiter_s *p_iter = p_granted; p_iter; p_iter = p_iter->p_next)
+            if ( p_iter->p_next == p_wsem->p_head ) { p_iter->p_next = (void *) 0; break; }
+
+    // Unlock
+    sync_word_unlock(&p_wsem->_lock);
+
+    // Wake the granted waiters. Each waiter returns as soon as it is
+    // granted, so read the next waiter before granting this one
+    while ( p_granted )
+    {
+
+        // Initialized data
+        struct wsem_waiter_s *p_next = p_granted->p_next;
+
+        // Grant
+        __atomic_store_n(&p_granted->granted, 1, __ATOMIC_RELEASE);
+        sync_futex_wake(&p_granted->granted, 1);
+
+        // Iterate
+        p_granted = p_next;
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_wsem:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_wsem\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            too_many_permits:
+
+                // Unlock
+                sync_word_unlock(&p_wsem->_lock);
+
+                #ifndef NDEBUG
+                    log_error("[sync] Parameter \"permits\" exceeds the capacity of the weighted semaphore in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int wsem_destroy ( wsem *p_wsem )
+{
+
+    // Argument check
+    if ( p_wsem == (void *) 0 ) goto no_wsem;
+
+    // Error check
+    if ( p_wsem->p_head ) goto wsem_waited;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_wsem:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_wsem\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Sync errors
+        {
+            wsem_waited:
+                #ifndef NDEBUG
+                    log_error("[sync] Weighted semaphore destroyed with waiters in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+#endif
+
+#ifdef BUILD_SYNC_WITH_CONDITION_VARIABLE
+int condition_variable_create ( condition_variable *p_condition_variable )
+{
+
+    // Argument check
+    if ( p_condition_variable == (void *) 0 ) goto no_condition_variable;
+    
+    // Platform dependent implementation
+    #ifdef _WIN64
+    #else
+
+        // Return
+        return ( pthread_cond_init(p_condition_variable, NULL) == 0 );
+    #endif
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_condition_variable:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_condition_variable\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int condition_variable_wait ( condition_variable *p_condition_variable, mutex *p_mutex )
+{
+
+    // Argument check
+    if ( p_condition_variable == (void *) 0 ) goto no_condition_variable;
+    if ( p_mutex              == (void *) 0 ) goto no_mutex;
+
+    // Platform dependent implementation
+    #ifdef _WIN64
+    #else
+
+        // Return
+        #ifdef BUILD_SYNC_WITH_STATS
+        {
+
+            // Initialized data
+            int ret = 0;
+
+            // The mutex isn't held while waiting
+            sync_stats_release(&p_mutex->_stats, p_mutex->_acquired);
+
+            // Wait
+            ret = ( pthread_cond_wait(p_condition_variable, &p_mutex->_mutex) == 0 );
+
+            // The mutex is held again, even if the wait timed out
+            p_mutex->_acquired = timer_high_precision();
+
+            // Return
+            return ret;
+        }
+        #else
+
+            // Return
+            return ( pthread_cond_wait(p_condition_variable, p_mutex) == 0 );
+        #endif
+    #endif
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_condition_variable:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_condition_variable\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+                
+            no_mutex:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_mutex\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int condition_variable_wait_timeout ( condition_variable *p_condition_variable, mutex *p_mutex, timestamp _time )
+{
+
+    // Argument check
+    if ( p_condition_variable == (void *) 0 ) goto no_condition_variable;
+    if ( p_mutex              == (void *) 0 ) goto no_mutex;
+    
+    // Platform dependent initialized data
+    #ifdef _WIN64
+    #else
+        struct timespec abstime = { 
+            .tv_sec  = _time * ( 1 / SEC_2_NS ),
+            .tv_nsec = _time % SEC_2_NS
+        };
+    #endif
+
+    // Platform dependent implementation
+    #ifdef _WIN64
+
+        // TODO
+    #else
+
+        // Return
+        #ifdef BUILD_SYNC_WITH_STATS
+        {
+
+            // Initialized data
+            int ret = 0;
+
+            // The mutex isn't held while waiting
+            sync_stats_release(&p_mutex->_stats, p_mutex->_acquired);
+
+            // Wait
+            ret = ( pthread_cond_timedwait(p_condition_variable, &p_mutex->_mutex, &abstime) == 0 );
+
+            // The mutex is held again, even if the wait timed out
+            p_mutex->_acquired = timer_high_precision();
+
+            // Return
+            return ret;
+        }
+        #else
+
+            // Return
+            return ( pthread_cond_timedwait(p_condition_variable, p_mutex, &abstime) == 0 );
+        #endif
+    #endif
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_condition_variable:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_condition_variable\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+                
+            no_mutex:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_mutex\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int condition_variable_signal ( condition_variable *p_condition_variable )
+{
+
+    // Platform dependent implementation
+    #ifdef _WIN64
+    #else
+
+        // Return
+        return pthread_cond_signal(p_condition_variable);
+    #endif
+}
+
+int condition_variable_broadcast ( condition_variable *p_condition_variable )
+{
+
+    // Platform dependent implementation
+    #ifdef _WIN64
+    #else
+
+        // Return
+        return pthread_cond_broadcast(p_condition_variable);
+    #endif
+}
+
+int condition_variable_destroy ( condition_variable *p_condition_variable )
+{
+
+    // Argument check
+    if ( p_condition_variable == (void *) 0 ) goto no_condition_variable;
+    
+    // Platform dependent implementation
+    #ifdef _WIN64
+    #else
+
+        // Return
+        return ( pthread_cond_destroy(p_condition_variable) == 0 );
+    #endif
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_condition_variable:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_condition_variable\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+#ifdef BUILD_SYNC_WITH_MUTEX
+/** !
+ * Lock a fast mutex after waiting on a fast condition variable. 
+ * Other waiters may have been requeued onto the mutex, so the 
+ * mutex is always marked contended, and the unlock wakes the next
+ * 
+ * @param p_fast_mutex the fast mutex
+ * 
+ * @return void
+ */
+static void fast_condition_variable_relock ( fast_mutex *p_fast_mutex )
+{
+
+    // Lock, and mark the mutex contended
+    while ( __atomic_exchange_n(&p_fast_mutex->_state, 2, __ATOMIC_ACQUIRE) != 0 )
+
+        // Sleep until the owner unlocks the mutex
+        sync_futex_wait(&p_fast_mutex->_state, 2);
+
+    // Done
+    return;
+}
+
+int fast_condition_variable_create ( fast_condition_variable *p_fast_condition_variable )
+{
+
+    // Argument check
+    if ( p_fast_condition_variable == (void *) 0 ) goto no_fast_condition_variable;
+
+    // No waiters
+    *p_fast_condition_variable = (fast_condition_variable) { 0 };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_fast_condition_variable:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_fast_condition_variable\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int fast_condition_variable_wait ( fast_condition_variable *p_fast_condition_variable, fast_mutex *p_fast_mutex )
+{
+
+    // Argument check
+    if ( p_fast_condition_variable == (void *) 0 ) goto no_fast_condition_variable;
+    if ( p_fast_mutex              == (void *) 0 ) goto no_fast_mutex;
+
+    // Count the caller as a waiter before reading the sequence, so a 
+    // signaler either sees the waiter, or the waiter sees the signal
+    __atomic_fetch_add(&p_fast_condition_variable->_waiters, 1, __ATOMIC_SEQ_CST);
+
+    // Initialized data
+    uint32_t sequence = __atomic_load_n(&p_fast_condition_variable->_sequence, __ATOMIC_SEQ_CST);
+
+    // Store the mutex, so broadcasts know where to requeue
+    __atomic_store_n(&p_fast_condition_variable->p_fast_mutex, p_fast_mutex, __ATOMIC_RELAXED);
+
+    // Unlock
+    fast_mutex_unlock(p_fast_mutex);
+
+    // Sleep until signaled, or requeued onto the mutex
+    sync_futex_wait(&p_fast_condition_variable->_sequence, sequence);
+
+    // No longer waiting
+    __atomic_fetch_sub(&p_fast_condition_variable->_waiters, 1, __ATOMIC_RELAXED);
+
+    // Lock
+    fast_condition_variable_relock(p_fast_mutex);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_fast_condition_variable:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_fast_condition_variable\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+                
+            no_fast_mutex:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_fast_mutex\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int fast_condition_variable_wait_timeout ( fast_condition_variable *p_fast_condition_variable, fast_mutex *p_fast_mutex, timestamp _time )
+{
+
+    // Argument check
+    if ( p_fast_condition_variable == (void *) 0 ) goto no_fast_condition_variable;
+    if ( p_fast_mutex              == (void *) 0 ) goto no_fast_mutex;
+
+    // Count the caller as a waiter before reading the sequence
+    __atomic_fetch_add(&p_fast_condition_variable->_waiters, 1, __ATOMIC_SEQ_CST);
+
+    // Initialized data
+    uint32_t sequence = __atomic_load_n(&p_fast_condition_variable->_sequence, __ATOMIC_SEQ_CST);
+    timestamp deadline = timer_monotonic_ns() + _time;
+    int ret = 0;
+
+    // Store the mutex, so broadcasts know where to requeue
+    __atomic_store_n(&p_fast_condition_variable->p_fast_mutex, p_fast_mutex, __ATOMIC_RELAXED);
+
+    // Unlock
+    fast_mutex_unlock(p_fast_mutex);
+
+    // Sleep until signaled, requeued onto the mutex, or the time runs out
+    if ( _time > 0 ) sync_futex_wait_timeout(&p_fast_condition_variable->_sequence, sequence, _time);
+
+    // Woken, unless the time ran out without a signal
+    ret = ( __atomic_load_n(&p_fast_condition_variable->_sequence, __ATOMIC_RELAXED) != sequence ) || ( timer_monotonic_ns() < deadline );
+
+    // No longer waiting
+    __atomic_fetch_sub(&p_fast_condition_variable->_waiters, 1, __ATOMIC_RELAXED);
+
+    // Lock
+    fast_condition_variable_relock(p_fast_mutex);
+
+    // Done
+    return ret;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_fast_condition_variable:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_fast_condition_variable\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+                
+            no_fast_mutex:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_fast_mutex\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int fast_condition_variable_signal ( fast_condition_variable *p_fast_condition_variable )
+{
+
+    // Argument check
+    if ( p_fast_condition_variable == (void *) 0 ) goto no_fast_condition_variable;
+
+    // Announce the signal
+    __atomic_fetch_add(&p_fast_condition_variable->_sequence, 1, __ATOMIC_SEQ_CST);
+
+    // Wake one waiter, if there are any
+    if ( __atomic_load_n(&p_fast_condition_variable->_waiters, __ATOMIC_SEQ_CST) ) sync_futex_wake(&p_fast_condition_variable->_sequence, 1);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_fast_condition_variable:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_fast_condition_variable\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int fast_condition_variable_broadcast ( fast_condition_variable *p_fast_condition_variable )
+{
+
+    // Argument check
+    if ( p_fast_condition_variable == (void *) 0 ) goto no_fast_condition_variable;
+
+    // Initialized data
+    uint32_t sequence = __atomic_add_fetch(&p_fast_condition_variable->_sequence, 1, __ATOMIC_SEQ_CST);
+    fast_mutex *p_fast_mutex = (void *) 0;
+
+    // Nobody is waiting
+    if ( __atomic_load_n(&p_fast_condition_variable->_waiters, __ATOMIC_SEQ_CST) == 0 ) return 1;
+
+    // Load the mutex the waiters sleep with
+    p_fast_mutex = __atomic_load_n(&p_fast_condition_variable->p_fast_mutex, __ATOMIC_RELAXED);
+
+    // No waiter has stored the mutex yet, so none of them is asleep
+    if ( p_fast_mutex == (void *) 0 ) return 1;
+
+    // Wake one waiter, and requeue the rest onto the mutex. The woken
+    // waiter marks the mutex contended, so each unlock wakes the next
+    if ( sync_futex_requeue(&p_fast_condition_variable->_sequence, sequence, &p_fast_mutex->_state) == false )
+
+        // The sequence moved, or requeue isn't supported. Wake everyone
+        sync_futex_wake(&p_fast_condition_variable->_sequence, INT_MAX);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_fast_condition_variable:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_fast_condition_variable\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int fast_condition_variable_destroy ( fast_condition_variable *p_fast_condition_variable )
+{
+
+    // Argument check
+    if ( p_fast_condition_variable == (void *) 0 ) goto no_fast_condition_variable;
+
+    // Clear the condition variable
+    *p_fast_condition_variable = (fast_condition_variable) { 0 };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_fast_condition_variable:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_fast_condition_variable\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+#endif
+#endif
+
+#ifdef BUILD_SYNC_WITH_MONITOR
+int monitor_create ( monitor *p_monitor )
+{
+
+    // Argument check
+    if ( p_monitor == (void *) 0 ) goto no_monitor;
+
+    // Unlocked, with no named queues
+    *p_monitor = (monitor) { 0 };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_monitor:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_monitor\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int monitor_queue ( monitor *p_monitor, const char *name, size_t *p_queue )
+{
+
+    // Argument check
+    if ( p_monitor == (void *) 0 ) goto no_monitor;
+    if ( name      == (void *) 0 ) goto no_name;
+    if ( p_queue   == (void *) 0 ) goto no_queue;
+
+    // Find the queue, or claim a free one. Queue 0 is the default queue
+    for (size_t i = 1; i < SYNC_MONITOR_QUEUES; i++)
+    {
+
+        // Initialized data
+        const char *p_name = __atomic_load_n(&p_monitor->_names[i], __ATOMIC_ACQUIRE);
+
+        // Claim a free queue
+        if ( p_name == (void *) 0 && __atomic_compare_exchange_n(&p_monitor->_names[i], &p_name, name, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ) 
+        {
+            *p_queue = i;
+            return 1;
+        }
+
+        // Match the name
+        if ( p_name == name || strcmp(p_name, name) == 0 )
+        {
+            *p_queue = i;
+            return 1;
+        }
+    }
+
+    // Out of queues
+    goto no_free_queue;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_monitor:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_monitor\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_name:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"name\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_queue:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_queue\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Sync errors
+        {
+            no_free_queue:
+                #ifndef NDEBUG
+                    log_error("[sync] Monitor has no free condition queues in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int monitor_enter ( monitor *p_monitor )
+{
+
+    // Argument check
+    if ( p_monitor == (void *) 0 ) goto no_monitor;
+
+    // Lock
+    return fast_mutex_lock(&p_monitor->_mutex);
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_monitor:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_monitor\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int monitor_exit ( monitor *p_monitor )
+{
+
+    // Argument check
+    if ( p_monitor == (void *) 0 ) goto no_monitor;
+
+    // Unlock
+    return fast_mutex_unlock(&p_monitor->_mutex);
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_monitor:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_monitor\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int monitor_wait_until ( monitor *p_monitor, size_t queue, fn_monitor_predicate *pfn_monitor_predicate, void *p_context )
+{
+
+    // Argument check
+    if ( p_monitor             == (void *) 0          ) goto no_monitor;
+    if ( queue                 >= SYNC_MONITOR_QUEUES ) goto bad_queue;
+    if ( pfn_monitor_predicate == (void *) 0          ) goto no_monitor_predicate;
+
+    // Wait until the predicate holds
+    while ( pfn_monitor_predicate(p_context) == false )
+        fast_condition_variable_wait(&p_monitor->_queues[queue], &p_monitor->_mutex);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_monitor:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_monitor\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            bad_queue:
+                #ifndef NDEBUG
+                    log_error("[sync] Parameter \"queue\" must be less than %d in call to function \"%s\"\n", SYNC_MONITOR_QUEUES, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_monitor_predicate:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"pfn_monitor_predicate\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int monitor_wait ( monitor *p_monitor )
+{
+
+    // Argument check
+    if ( p_monitor == (void *) 0 ) goto no_monitor;
+
+    // Enter
+    fast_mutex_lock(&p_monitor->_mutex);
+
+    // Wait
+    fast_condition_variable_wait(&p_monitor->_queues[0], &p_monitor->_mutex);
+
+    // Exit
+    fast_mutex_unlock(&p_monitor->_mutex);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_monitor:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_monitor\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int monitor_notify ( monitor *p_monitor )
+{
+
+    // Signal the default queue
+    return monitor_notify_queue(p_monitor, 0);
+}
+
+int monitor_notify_all ( monitor *p_monitor )
+{
+
+    // Broadcast to the default queue
+    return monitor_notify_all_queue(p_monitor, 0);
+}
+
+int monitor_notify_queue ( monitor *p_monitor, size_t queue )
+{
+
+    // Argument check
+    if ( p_monitor == (void *) 0          ) goto no_monitor;
+    if ( queue     >= SYNC_MONITOR_QUEUES ) goto bad_queue;
+
+    // Signal
+    return fast_condition_variable_signal(&p_monitor->_queues[queue]);
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_monitor:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_monitor\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            bad_queue:
+                #ifndef NDEBUG
+                    log_error("[sync] Parameter \"queue\" must be less than %d in call to function \"%s\"\n", SYNC_MONITOR_QUEUES, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int monitor_notify_all_queue ( monitor *p_monitor, size_t queue )
+{
+
+    // Argument check
+    if ( p_monitor == (void *) 0          ) goto no_monitor;
+    if ( queue     >= SYNC_MONITOR_QUEUES ) goto bad_queue;
+
+    // Broadcast. Waiters are requeued onto the monitor's mutex
+    return fast_condition_variable_broadcast(&p_monitor->_queues[queue]);
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_monitor:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_monitor\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            bad_queue:
+                #ifndef NDEBUG
+                    log_error("[sync] Parameter \"queue\" must be less than %d in call to function \"%s\"\n", SYNC_MONITOR_QUEUES, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int monitor_destroy ( monitor *p_monitor )
+{
+    
+    // Argument check
+    if ( p_monitor == (void *) 0 ) goto no_monitor;
+
+    // Error check
+    if ( __atomic_load_n(&p_monitor->_mutex._state, __ATOMIC_ACQUIRE) ) goto monitor_entered;
+
+    // Clear the monitor
+    *p_monitor = (monitor) { 0 };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_monitor:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_monitor\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Sync errors
+        {
+            monitor_entered:
+                #ifndef NDEBUG
+                    log_error("[sync] Monitor destroyed while entered in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+#endif
+
+#ifdef BUILD_SYNC_WITH_BARRIER
+/** !
+ * Claim a seat at a leaf of a barrier. Every leaf seats a fixed 
+ * quantity of threads per phase, and stays full until the release,
+ * so a full leaf sends the caller to the next one
+ * 
+ * @param p_barrier the barrier
+ * @param pp_node   return the leaf
+ * 
+ * @return the seat
+ */
+static uint32_t barrier_claim_seat ( barrier *p_barrier, struct barrier_node_s **pp_node )
+{
+
+    // Initialized data
+    struct barrier_node_s *p_nodes = p_barrier->p_nodes;
+    size_t leaf = sync_thread_index() % p_barrier->_leaves;
+    struct barrier_node_s *p_node = &p_nodes[leaf];
+    uint32_t arrived = 0;
+
+    // Claim a seat
+    for (;;)
+    {
+
+        // Initialized data
+        arrived = __atomic_load_n(&p_node->arrived, __ATOMIC_RELAXED);
+
+        // Claim a seat
+        if ( arrived < p_node->expected && __atomic_compare_exchange_n(&p_node->arrived, &arrived, arrived + 1, true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED) ) break;
+
+        // The leaf is full
+        if ( arrived >= p_node->expected ) leaf = ( leaf + 1 ) % p_barrier->_leaves, p_node = &p_nodes[leaf];
+    }
+
+    // Return the leaf
+    *pp_node = p_node;
+
+    // Success
+    return arrived;
+}
+
+/** !
+ * Arrive at a barrier. The caller claims a seat at a leaf, and the 
+ * last thread to arrive at each node carries the arrival upward
+ * 
+ * @param p_barrier the barrier
+ * 
+ * @return true if the caller was the last thread to arrive, else false
+ */
+static bool barrier_arrive_tree ( barrier *p_barrier )
+{
+
+    // Initialized data
+    struct barrier_node_s *p_node = (void *) 0;
+    uint32_t arrived = barrier_claim_seat(p_barrier, &p_node);
+
+    // The last thread to arrive at a node arrives at its parent
+    while ( arrived + 1 == p_node->expected )
+    {
+
+        // The caller arrived last at the root
+        if ( p_node->p_parent == (void *) 0 ) return true;
+
+        // Arrive at the parent
+        p_node  = p_node->p_parent;
+        arrived = __atomic_fetch_add(&p_node->arrived, 1, __ATOMIC_ACQ_REL);
+    }
+
+    // Done
+    return false;
+}
+
+/** !
+ * Arrive at a barrier with a value. Each arrival writes its value
+ * into its seat, then counts itself as filled. The last thread to 
+ * fill a node combines the values of the node, and carries the 
+ * partial result upward
+ * 
+ * @param p_barrier         the barrier
+ * @param p_value           the caller's value, and the result if the caller was the last thread to arrive
+ * @param pfn_barrier_reduce the reduction
+ * 
+ * @return true if the caller was the last thread to arrive, else false
+ */
+static bool barrier_arrive_tree_reduce ( barrier *p_barrier, double *p_value, fn_barrier_reduce *pfn_barrier_reduce )
+{
+
+    // Initialized data
+    struct barrier_node_s *p_node = (void *) 0;
+    uint32_t seat = barrier_claim_seat(p_barrier, &p_node);
+    double value = *p_value;
+
+    // The last thread to fill a node arrives at its parent
+    for (;;)
+    {
+
+        // Fill the seat
+        p_node->values[seat] = value;
+
+        // The node is not full
+        if ( __atomic_add_fetch(&p_node->filled, 1, __ATOMIC_ACQ_REL) != p_node->expected ) return false;
+
+        // Combine the values of the node
+        value = p_node->values[0];
+        for (uint32_t i = 1; i < p_node->expected; i++) value = pfn_barrier_reduce(value, p_node->values[i]);
+
+        // The caller arrived last at the root
+        if ( p_node->p_parent == (void *) 0 ) break;
+
+        // Arrive at the parent
+        p_node = p_node->p_parent;
+        seat   = __atomic_fetch_add(&p_node->arrived, 1, __ATOMIC_RELAXED);
+    }
+
+    // Return the result
+    *p_value = value;
+
+    // Done
+    return true;
+}
+
+/** !
+ * Run the completion function, then release the threads that are
+ * waiting on a barrier phase. Only the last thread to arrive calls
+ * this, so every node is full until the tree is reset here. A full 
+ * leaf stays full for the whole phase, and a late thread can't take 
+ * a seat that an earlier thread of the same phase already used.
+ * 
+ * @param p_barrier the barrier
+ * 
+ * @return void
+ */
+static void barrier_release ( barrier *p_barrier )
+{
+
+    // Initialized data
+    struct barrier_node_s *p_nodes = p_barrier->p_nodes;
+
+    // Reset the tree for the next phase. Nobody arrives until the release
+    for (size_t i = 0; i < p_barrier->_nodes; i++)
+    {
+        __atomic_store_n(&p_nodes[i].arrived, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&p_nodes[i].filled , 0, __ATOMIC_RELAXED);
+    }
+
+    // Complete the phase
+    if ( p_barrier->pfn_barrier_completion ) p_barrier->pfn_barrier_completion(p_barrier->p_completion_context);
+
+    // Flip the phase
+    __atomic_fetch_add(&p_barrier->_phase, 1, __ATOMIC_SEQ_CST);
+
+    // Wake the parked threads
+    if ( __atomic_load_n(&p_barrier->_sleepers, __ATOMIC_SEQ_CST) ) sync_futex_wake(&p_barrier->_phase, INT_MAX);
+
+    // Done
+    return;
+}
+
+/** !
+ * Wait for a barrier phase to end. Spin briefly, then park
+ * 
+ * @param p_barrier the barrier
+ * @param phase     the phase
+ * 
+ * @return void
+ */
+static void barrier_wait_phase ( barrier *p_barrier, uint32_t phase )
+{
+
+    // Initialized data
+    unsigned int spins = 0;
+
+    // Wait for the phase to flip
+    while ( __atomic_load_n(&p_barrier->_phase, __ATOMIC_ACQUIRE) == phase )
+    {
+
+        // Spin
+        if ( sync_processors > 1 && spins < SYNC_BARRIER_SPIN ) 
+        {
+            sync_pause();
+            spins++;
+            continue;
+        }
+
+        // Park
+        __atomic_fetch_add(&p_barrier->_sleepers, 1, __ATOMIC_SEQ_CST);
+        if ( __atomic_load_n(&p_barrier->_phase, __ATOMIC_SEQ_CST) == phase ) sync_futex_wait(&p_barrier->_phase, phase);
+        __atomic_fetch_sub(&p_barrier->_sleepers, 1, __ATOMIC_RELAXED);
+    }
+
+    // Done
+    return;
+}
+
+int barrier_create ( barrier *p_barrier, unsigned int count )
+{
+
+    // Success
+    return barrier_create_completion(p_barrier, count, (void *) 0, (void *) 0);
+}
+
+int barrier_create_completion ( barrier *p_barrier, unsigned int count, fn_barrier_completion *pfn_barrier_completion, void *p_context )
+{
+
+    // Argument check
+    if ( p_barrier == (void *) 0 ) goto no_barrier;
+    if ( count     ==          0 ) goto no_count;
+
+    // Initialized data
+    size_t leaves = ( count + SYNC_BARRIER_FAN_IN - 1 ) / SYNC_BARRIER_FAN_IN,
+           nodes  = 0;
+    struct barrier_node_s *p_nodes = (void *) 0;
+
+    // Count the nodes of the tree
+    for (size_t level = leaves; ; level = ( level + SYNC_BARRIER_FAN_IN - 1 ) / SYNC_BARRIER_FAN_IN)
+    {
+        nodes += level;
+        if ( level == 1 ) break;
+    }
+
+    // Allocate the tree
+    if ( posix_memalign((void **)&p_nodes, SYNC_CACHE_LINE, nodes * sizeof(struct barrier_node_s)) ) goto no_mem;
+
+    // Zero set
+    memset(p_nodes, 0, nodes * sizeof(struct barrier_node_s));
+
+    // Spread the threads evenly over the leaves
+    for (size_t i = 0; i < leaves; i++) p_nodes[i].expected = (uint32_t) ( count / leaves + ( i < count % leaves ) );
+
+    // Link each level to the level above it
+    for (size_t first = 0, level = leaves; level > 1; )
+    {
+
+        // Initialized data
+        size_t parents = ( level + SYNC_BARRIER_FAN_IN - 1 ) / SYNC_BARRIER_FAN_IN;
+
+        // Link each node to its parent
+        for (size_t i = 0; i < level; i++)
+        {
+
+            // Initialized data
+            struct barrier_node_s *p_parent = &p_nodes[first + level + i / SYNC_BARRIER_FAN_IN];
+
+            // Link
+            p_nodes[first + i].p_parent = p_parent;
+            p_parent->expected++;
+        }
+
+        // Iterate
+        first += level, level = parents;
+    }
+
+    // Populate the barrier
+    *p_barrier = (barrier)
+    {
+        ._count                 = count,
+        ._leaves                = leaves,
+        ._nodes                 = nodes,
+        .p_nodes                = p_nodes,
+        .pfn_barrier_completion = pfn_barrier_completion,
+        .p_completion_context   = p_context
+    };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_barrier:
+                #ifndef NDEBUG
+                    log_error("[sync] [barrier] Null pointer provided for parameter \"p_barrier\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+            
+            no_count:
+                #ifndef NDEBUG
+                    log_error("[sync] [barrier] Parameter \"count\" must be greater than zero in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;                
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int barrier_wait ( barrier *p_barrier )
+{
+
+    // Argument check
+    if ( p_barrier == (void *) 0 ) goto no_barrier;
+
+    // Initialized data
+    uint32_t phase = __atomic_load_n(&p_barrier->_phase, __ATOMIC_ACQUIRE);
+
+    // The last thread to arrive releases the others
+    if ( barrier_arrive_tree(p_barrier) )
+    {
+
+        // Release
+        barrier_release(p_barrier);
+
+        // Success
+        return SYNC_BARRIER_SERIAL_THREAD;
+    }
+
+    // Wait for the release
+    barrier_wait_phase(p_barrier, phase);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_barrier:
+                #ifndef NDEBUG
+                    log_error("[sync] [barrier] Null pointer provided for parameter \"p_barrier\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int barrier_wait_reduce ( barrier *p_barrier, double *p_value, fn_barrier_reduce *pfn_barrier_reduce )
+{
+
+    // Argument check
+    if ( p_barrier          == (void *) 0 ) goto no_barrier;
+    if ( p_value            == (void *) 0 ) goto no_value;
+    if ( pfn_barrier_reduce == (void *) 0 ) goto no_reduce;
+
+    // Initialized data
+    uint32_t phase = __atomic_load_n(&p_barrier->_phase, __ATOMIC_ACQUIRE);
+
+    // The last thread to arrive publishes the result, and releases the others
+    if ( barrier_arrive_tree_reduce(p_barrier, p_value, pfn_barrier_reduce) )
+    {
+
+        // Publish the result
+        p_barrier->_result = *p_value;
+
+        // Release
+        barrier_release(p_barrier);
+
+        // Success
+        return SYNC_BARRIER_SERIAL_THREAD;
+    }
+
+    // Wait for the release
+    barrier_wait_phase(p_barrier, phase);
+
+    // Read the result. It is stable until this thread arrives again
+    *p_value = p_barrier->_result;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_barrier:
+                #ifndef NDEBUG
+                    log_error("[sync] [barrier] Null pointer provided for parameter \"p_barrier\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_value:
+                #ifndef NDEBUG
+                    log_error("[sync] [barrier] Null pointer provided for parameter \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_reduce:
+                #ifndef NDEBUG
+                    log_error("[sync] [barrier] Null pointer provided for parameter \"pfn_barrier_reduce\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+double barrier_reduce_sum ( double a, double b )
+{
+
+    // Success
+    return a + b;
+}
+
+double barrier_reduce_min ( double a, double b )
+{
+
+    // Success
+    return ( a < b ) ? a : b;
+}
+
+double barrier_reduce_max ( double a, double b )
+{
+
+    // Success
+    return ( a > b ) ? a : b;
+}
+
+int barrier_arrive ( barrier *p_barrier, uint32_t *p_token )
+{
+
+    // Argument check
+    if ( p_barrier == (void *) 0 ) goto no_barrier;
+    if ( p_token   == (void *) 0 ) goto no_token;
+
+    // Store the phase the caller arrives in
+    *p_token = __atomic_load_n(&p_barrier->_phase, __ATOMIC_ACQUIRE);
+
+    // The last thread to arrive releases the others
+    if ( barrier_arrive_tree(p_barrier) ) barrier_release(p_barrier);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_barrier:
+                #ifndef NDEBUG
+                    log_error("[sync] [barrier] Null pointer provided for parameter \"p_barrier\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_token:
+                #ifndef NDEBUG
+                    log_error("[sync] [barrier] Null pointer provided for parameter \"p_token\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int barrier_wait_token ( barrier *p_barrier, uint32_t token )
+{
+
+    // Argument check
+    if ( p_barrier == (void *) 0 ) goto no_barrier;
+
+    // Wait for the release
+    barrier_wait_phase(p_barrier, token);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_barrier:
+                #ifndef NDEBUG
+                    log_error("[sync] [barrier] Null pointer provided for parameter \"p_barrier\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int barrier_destroy ( barrier *p_barrier )
+{
+
+    // Argument check
+    if ( p_barrier == (void *) 0 ) goto no_barrier;
+
+    // Free the tree
+    free(p_barrier->p_nodes);
+
+    // Clear the barrier
+    *p_barrier = (barrier) { 0 };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_barrier:
+                #ifndef NDEBUG
+                    log_error("[sync] [barrier] Null pointer provided for parameter \"p_barrier\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+#endif
+
+#ifdef BUILD_SYNC_WITH_PHASER
+/** !
+ * Bring a tier up to the phase of the root. A tier that arrived in 
+ * an earlier phase starts the current phase with every party unarrived
+ * 
+ * @param p_phaser the phaser
+ * 
+ * @return the state of the phaser
+ */
+static uint64_t phaser_reconcile ( phaser *p_phaser )
+{
+
+    // Initialized data
+    uint64_t state = __atomic_load_n(&p_phaser->_state, __ATOMIC_ACQUIRE);
+    uint32_t phase = 0;
+
+    // The root is always current
+    if ( p_phaser->p_parent == (void *) 0 ) return state;
+
+    // Read the phase of the root
+    phase = SYNC_PHASER_GET_PHASE(__atomic_load_n(&p_phaser->p_root->_state, __ATOMIC_ACQUIRE));
+
+    // Start the current phase
+    while ( SYNC_PHASER_GET_PHASE(state) != phase )
+    {
+
+        // Initialized data
+        uint32_t parties = SYNC_PHASER_GET_PARTIES(state);
+        uint64_t next = SYNC_PHASER_STATE(phase, parties, parties);
+
+        // Update the tier
+        if ( __atomic_compare_exchange_n(&p_phaser->_state, &state, next, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ) return next;
+    }
+
+    // Done
+    return state;
+}
+
+/** !
+ * Wait for the root of a phaser to leave a phase. Spin briefly, then park
+ * 
+ * @param p_phaser the phaser
+ * @param phase    the phase
+ * 
+ * @return void
+ */
+static void phaser_wait_phase ( phaser *p_phaser, uint32_t phase )
+{
+
+    // Initialized data
+    phaser *p_root = p_phaser->p_root;
+    uint32_t *p_futex = SYNC_PHASER_FUTEX(p_root);
+    unsigned int spins = 0;
+
+    // Wait for the phase to advance
+    while ( __atomic_load_n(p_futex, __ATOMIC_ACQUIRE) == phase )
+    {
+
+        // Spin
+        if ( sync_processors > 1 && spins < SYNC_BARRIER_SPIN ) 
+        {
+            sync_pause();
+            spins++;
+            continue;
+        }
+
+        // Park
+        __atomic_fetch_add(&p_root->_sleepers, 1, __ATOMIC_SEQ_CST);
+        if ( __atomic_load_n(p_futex, __ATOMIC_SEQ_CST) == phase ) sync_futex_wait(p_futex, phase);
+        __atomic_fetch_sub(&p_root->_sleepers, 1, __ATOMIC_RELAXED);
+    }
+
+    // Done
+    return;
+}
+
+/** !
+ * Arrive at a phaser. The last party to arrive at the root advances 
+ * the phase. The last party to arrive at a tier arrives at the parent
+ * 
+ * @param p_phaser   the phaser
+ * @param deregister true if the caller's party leaves the phaser, else false
+ * @param p_phase    return the phase the caller arrived in
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int phaser_arrive_internal ( phaser *p_phaser, bool deregister, uint32_t *p_phase )
+{
+
+    // Initialized data
+    uint64_t adjust = SYNC_PHASER_UNARRIVED + ( deregister ? SYNC_PHASER_PARTY : 0 );
+
+    for (;;)
+    {
+
+        // Initialized data
+        uint64_t state = phaser_reconcile(p_phaser),
+                 next  = state - adjust;
+        uint32_t phase = SYNC_PHASER_GET_PHASE(state);
+
+        // The caller has no party
+        if ( SYNC_PHASER_GET_UNARRIVED(state) == 0 ) return 0;
+
+        // The last party to arrive at the root advances the phase
+        if ( SYNC_PHASER_GET_UNARRIVED(next) == 0 && p_phaser->p_parent == (void *) 0 )
+        {
+
+            // Initialized data
+            uint32_t parties = SYNC_PHASER_GET_PARTIES(next);
+
+            // Advance the phase
+            if ( !__atomic_compare_exchange_n(&p_phaser->_state, &state, SYNC_PHASER_STATE(phase + 1, parties, parties), false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED) ) continue;
+
+            // Wake the parked parties
+            if ( __atomic_load_n(&p_phaser->_sleepers, __ATOMIC_SEQ_CST) ) sync_futex_wake(SYNC_PHASER_FUTEX(p_phaser), INT_MAX);
+        }
+
+        // Arrive
+        else if ( !__atomic_compare_exchange_n(&p_phaser->_state, &state, next, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED) ) continue;
+
+        // The last party to arrive at a tier arrives at the parent. 
+        // A tier with no parties left leaves the parent
+        else if ( SYNC_PHASER_GET_UNARRIVED(next) == 0 ) 
+            if ( phaser_arrive_internal(p_phaser->p_parent, SYNC_PHASER_GET_PARTIES(next) == 0, &phase) == 0 ) return 0;
+
+        // Return the phase
+        *p_phase = phase;
+
+        // Success
+        return 1;
+    }
+}
+
+int phaser_create ( phaser *p_phaser, phaser *p_parent, unsigned int parties )
+{
+
+    // Argument check
+    if ( p_phaser == (void *) 0               ) goto no_phaser;
+    if ( parties  > SYNC_PHASER_MAX_PARTIES ) goto too_many_parties;
+
+    // Initialized data
+    uint32_t phase = 0;
+
+    // A tier with parties registers with its parent
+    if ( p_parent )
+    {
+
+        // Register with the parent
+        if ( parties && phaser_register(p_parent) == 0 ) goto failed_to_register;
+
+        // Start in the phase of the root
+        phase = SYNC_PHASER_GET_PHASE(__atomic_load_n(&p_parent->p_root->_state, __ATOMIC_ACQUIRE));
+    }
+
+    // Populate the phaser
+    *p_phaser = (phaser)
+    {
+        ._state   = SYNC_PHASER_STATE(phase, parties, parties),
+        .p_parent = p_parent,
+        .p_root   = p_parent ? p_parent->p_root : p_phaser
+    };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_phaser:
+                #ifndef NDEBUG
+                    log_error("[sync] [phaser] Null pointer provided for parameter \"p_phaser\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            too_many_parties:
+                #ifndef NDEBUG
+                    log_error("[sync] [phaser] Parameter \"parties\" must not exceed %d in call to function \"%s\"\n", SYNC_PHASER_MAX_PARTIES, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Phaser errors
+        {
+            failed_to_register:
+                #ifndef NDEBUG
+                    log_error("[sync] [phaser] Failed to register with the parent phaser in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int phaser_register ( phaser *p_phaser )
+{
+
+    // Argument check
+    if ( p_phaser == (void *) 0 ) goto no_phaser;
+
+    for (;;)
+    {
+
+        // Initialized data
+        uint64_t state   = phaser_reconcile(p_phaser);
+        uint32_t parties = SYNC_PHASER_GET_PARTIES(state);
+
+        // Too many parties
+        if ( parties == SYNC_PHASER_MAX_PARTIES ) goto too_many_parties;
+
+        // The first party of a tier registers the tier with its parent
+        if ( parties == 0 && p_phaser->p_parent )
+        {
+
+            // Lock
+            sync_word_lock(&p_phaser->_lock);
+
+            // Another thread registered the first party
+            if ( SYNC_PHASER_GET_PARTIES(phaser_reconcile(p_phaser)) )
+            {
+                sync_word_unlock(&p_phaser->_lock);
+                continue;
+            }
+
+            // Register with the parent. The root can not advance 
+            // until the tier arrives, so its phase is stable
+            if ( phaser_register(p_phaser->p_parent) == 0 )
+            {
+                sync_word_unlock(&p_phaser->_lock);
+                goto failed_to_register;
+            }
+
+            // Start the current phase with one party
+            __atomic_store_n(&p_phaser->_state, SYNC_PHASER_STATE(SYNC_PHASER_GET_PHASE(__atomic_load_n(&p_phaser->p_root->_state, __ATOMIC_ACQUIRE)), 1, 1), __ATOMIC_RELEASE);
+
+            // Unlock
+            sync_word_unlock(&p_phaser->_lock);
+
+            // Success
+            return 1;
+        }
+
+        // The tier already arrived in this phase. Wait for the next phase
+        if ( parties && SYNC_PHASER_GET_UNARRIVED(state) == 0 )
+        {
+            phaser_wait_phase(p_phaser, SYNC_PHASER_GET_PHASE(state));
+            continue;
+        }
+
+        // Register
+        if ( __atomic_compare_exchange_n(&p_phaser->_state, &state, state + SYNC_PHASER_PARTY + SYNC_PHASER_UNARRIVED, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED) ) return 1;
+    }
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_phaser:
+                #ifndef NDEBUG
+                    log_error("[sync] [phaser] Null pointer provided for parameter \"p_phaser\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Phaser errors
+        {
+            too_many_parties:
+                #ifndef NDEBUG
+                    log_error("[sync] [phaser] Phaser has %d parties in call to function \"%s\"\n", SYNC_PHASER_MAX_PARTIES, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_register:
+                #ifndef NDEBUG
+                    log_error("[sync] [phaser] Failed to register with the parent phaser in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int phaser_arrive ( phaser *p_phaser, uint32_t *p_token )
+{
+
+    // Argument check
+    if ( p_phaser == (void *) 0 ) goto no_phaser;
+    if ( p_token  == (void *) 0 ) goto no_token;
+
+    // Arrive
+    if ( phaser_arrive_internal(p_phaser, false, p_token) == 0 ) goto no_party;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_phaser:
+                #ifndef NDEBUG
+                    log_error("[sync] [phaser] Null pointer provided for parameter \"p_phaser\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_token:
+                #ifndef NDEBUG
+                    log_error("[sync] [phaser] Null pointer provided for parameter \"p_token\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Phaser errors
+        {
+            no_party:
+                #ifndef NDEBUG
+                    log_error("[sync] [phaser] More arrivals than registered parties in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int phaser_arrive_and_deregister ( phaser *p_phaser, uint32_t *p_token )
+{
+
+    // Argument check
+    if ( p_phaser == (void *) 0 ) goto no_phaser;
+    if ( p_token  == (void *) 0 ) goto no_token;
+
+    // Arrive, and leave
+    if ( phaser_arrive_internal(p_phaser, true, p_token) == 0 ) goto no_party;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_phaser:
+                #ifndef NDEBUG
+                    log_error("[sync] [phaser] Null pointer provided for parameter \"p_phaser\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_token:
+                #ifndef NDEBUG
+                    log_error("[sync] [phaser] Null pointer provided for parameter \"p_token\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Phaser errors
+        {
+            no_party:
+                #ifndef NDEBUG
+                    log_error("[sync] [phaser] More arrivals than registered parties in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int phaser_arrive_and_wait ( phaser *p_phaser )
+{
+
+    // Argument check
+    if ( p_phaser == (void *) 0 ) goto no_phaser;
+
+    // Initialized data
+    uint32_t phase = 0;
+
+    // Arrive
+    if ( phaser_arrive_internal(p_phaser, false, &phase) == 0 ) goto no_party;
+
+    // Wait for the other parties
+    phaser_wait_phase(p_phaser, phase);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_phaser:
+                #ifndef NDEBUG
+                    log_error("[sync] [phaser] Null pointer provided for parameter \"p_phaser\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Phaser errors
+        {
+            no_party:
+                #ifndef NDEBUG
+                    log_error("[sync] [phaser] More arrivals than registered parties in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int phaser_wait_token ( phaser *p_phaser, uint32_t token )
+{
+
+    // Argument check
+    if ( p_phaser == (void *) 0 ) goto no_phaser;
+
+    // Wait for the phase to advance
+    phaser_wait_phase(p_phaser, token);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_phaser:
+                #ifndef NDEBUG
+                    log_error("[sync] [phaser] Null pointer provided for parameter \"p_phaser\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int phaser_destroy ( phaser *p_phaser )
+{
+
+    // Argument check
+    if ( p_phaser == (void *) 0 ) goto no_phaser;
+
+    // Clear the phaser
+    *p_phaser = (phaser) { 0 };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_phaser:
+                #ifndef NDEBUG
+                    log_error("[sync] [phaser] Null pointer provided for parameter \"p_phaser\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+#endif
+
+#ifdef BUILD_SYNC_WITH_LATCH
+int latch_create ( latch *p_latch, unsigned int count )
+{
+
+    // Argument check
+    if ( p_latch == (void *) 0      ) goto no_latch;
+    if ( count   > SYNC_LATCH_COUNT ) goto too_large;
+
+    // Populate the latch
+    *p_latch = (latch) { ._count = count };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_latch:
+                #ifndef NDEBUG
+                    log_error("[sync] [latch] Null pointer provided for parameter \"p_latch\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Latch errors
+        {
+            too_large:
+                #ifndef NDEBUG
+                    log_error("[sync] [latch] Count must not exceed %u in call to function \"%s\"\n", SYNC_LATCH_COUNT, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int latch_add ( latch *p_latch, unsigned int n )
+{
+
+    // Argument check
+    if ( p_latch == (void *) 0 ) goto no_latch;
+
+    // Initialized data
+    uint32_t count = __atomic_load_n(&p_latch->_count, __ATOMIC_RELAXED);
+
+    // Add to the count, unless it would spill into the waiters flag
+    do
+    {
+
+        // Error check
+        if ( n > SYNC_LATCH_COUNT - ( count & SYNC_LATCH_COUNT ) ) goto too_large;
+    }
+    while ( !__atomic_compare_exchange_n(&p_latch->_count, &count, count + n, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED) );
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_latch:
+                #ifndef NDEBUG
+                    log_error("[sync] [latch] Null pointer provided for parameter \"p_latch\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Latch errors
+        {
+            too_large:
+                #ifndef NDEBUG
+                    log_error("[sync] [latch] Count overflowed in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int latch_count_down_slow ( latch *p_latch, uint32_t count, unsigned int n )
+{
+
+    // Argument check
+    if ( p_latch == (void *) 0 ) goto no_latch;
+
+    // Error check. The count already wrapped, so this only reports the mistake
+    if ( ( count & SYNC_LATCH_COUNT ) < n ) goto underflow;
+
+    // Nobody is waiting
+    if ( ( count & SYNC_LATCH_WAITERS ) == 0 ) return 1;
+
+    // Clear the waiters flag, unless the latch was reused
+    count = SYNC_LATCH_WAITERS;
+    __atomic_compare_exchange_n(&p_latch->_count, &count, 0, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+
+    // Wake every waiter
+    sync_futex_wake(&p_latch->_count, INT_MAX);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_latch:
+                #ifndef NDEBUG
+                    log_error("[sync] [latch] Null pointer provided for parameter \"p_latch\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Latch errors
+        {
+            underflow:
+                #ifndef NDEBUG
+                    log_error("[sync] [latch] Counted down past zero in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int latch_wait ( latch *p_latch )
+{
+
+    // Argument check
+    if ( p_latch == (void *) 0 ) goto no_latch;
+
+    // Initialized data
+    uint32_t count = __atomic_load_n(&p_latch->_count, __ATOMIC_ACQUIRE);
+    unsigned int spins = 0;
+
+    // Wait for the count to reach zero
+    while ( count & SYNC_LATCH_COUNT )
+    {
+
+        // Spin
+        if ( sync_processors > 1 && spins < SYNC_LATCH_SPIN )
+        {
+            sync_pause();
+            spins++;
+        }
+
+        // Flag the waiter, then park
+        else if ( ( count & SYNC_LATCH_WAITERS ) || __atomic_compare_exchange_n(&p_latch->_count, &count, count | SYNC_LATCH_WAITERS, false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE) )
+            sync_futex_wait(&p_latch->_count, count | SYNC_LATCH_WAITERS);
+
+        // Reload
+        count = __atomic_load_n(&p_latch->_count, __ATOMIC_ACQUIRE);
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_latch:
+                #ifndef NDEBUG
+                    log_error("[sync] [latch] Null pointer provided for parameter \"p_latch\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int latch_destroy ( latch *p_latch )
+{
+
+    // Argument check
+    if ( p_latch == (void *) 0 ) goto no_latch;
+
+    // Clear the latch
+    *p_latch = (latch) { 0 };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_latch:
+                #ifndef NDEBUG
+                    log_error("[sync] [latch] Null pointer provided for parameter \"p_latch\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+#endif
+
+#ifdef BUILD_SYNC_WITH_ONCE
+int sync_once_slow ( once_flag *p_once_flag, fn_sync_once *pfn_sync_once, void *p_parameter )
+{
+
+    // Argument check
+    if ( p_once_flag   == (void *) 0 ) goto no_once_flag;
+    if ( pfn_sync_once == (void *) 0 ) goto no_sync_once;
+
+    // Initialized data
+    uint32_t state = __atomic_load_n(&p_once_flag->_state, __ATOMIC_ACQUIRE);
+
+    // Wait for the initializer to run
+    while ( state != SYNC_ONCE_DONE )
+    {
+
+        // The caller is first
+        if ( state == 0 )
+        {
+
+            // Claim the initializer
+            if ( !__atomic_compare_exchange_n(&p_once_flag->_state, &state, SYNC_ONCE_RUNNING, false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE) ) continue;
+
+            // Run the initializer
+            pfn_sync_once(p_parameter);
+
+            // Publish, and wake the sleeping callers
+            if ( __atomic_exchange_n(&p_once_flag->_state, SYNC_ONCE_DONE, __ATOMIC_RELEASE) == SYNC_ONCE_WAITERS ) sync_futex_wake(&p_once_flag->_state, INT_MAX);
+
+            // Success
+            return 1;
+        }
+
+        // Flag the sleeper, then sleep
+        if ( state == SYNC_ONCE_WAITERS || __atomic_compare_exchange_n(&p_once_flag->_state, &state, SYNC_ONCE_WAITERS, false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE) )
+            sync_futex_wait(&p_once_flag->_state, SYNC_ONCE_WAITERS);
+
+        // Reload
+        state = __atomic_load_n(&p_once_flag->_state, __ATOMIC_ACQUIRE);
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_once_flag:
+                #ifndef NDEBUG
+                    log_error("[sync] [once] Null pointer provided for parameter \"p_once_flag\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_sync_once:
+                #ifndef NDEBUG
+                    log_error("[sync] [once] Null pointer provided for parameter \"pfn_sync_once\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+#endif
+
+#ifdef BUILD_SYNC_WITH_EVENTCOUNT
+int ec_create ( eventcount *p_eventcount )
+{
+
+    // Argument check
+    if ( p_eventcount == (void *) 0 ) goto no_eventcount;
+
+    // No waiters, first epoch
+    *p_eventcount = (eventcount) { 0 };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_eventcount:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_eventcount\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+uint32_t ec_prepare_wait ( eventcount *p_eventcount )
+{
+
+    // Argument check
+    if ( p_eventcount == (void *) 0 ) goto no_eventcount;
+
+    // Count the waiter, and return the epoch. Notifies that follow see the waiter
+    return (uint32_t) ( __atomic_fetch_add(&p_eventcount->_state, 1, __ATOMIC_SEQ_CST) >> 32 );
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_eventcount:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_eventcount\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int ec_cancel_wait ( eventcount *p_eventcount )
+{
+
+    // Argument check
+    if ( p_eventcount == (void *) 0 ) goto no_eventcount;
+
+    // Withdraw the waiter
+    __atomic_fetch_sub(&p_eventcount->_state, 1, __ATOMIC_RELAXED);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_eventcount:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_eventcount\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int ec_wait ( eventcount *p_eventcount, uint32_t key )
+{
+
+    // Argument check
+    if ( p_eventcount == (void *) 0 ) goto no_eventcount;
+
+    // Sleep until the epoch moves on
+    while ( __atomic_load_n(SYNC_EVENTCOUNT_FUTEX(p_eventcount), __ATOMIC_ACQUIRE) == key )
+        sync_futex_wait(SYNC_EVENTCOUNT_FUTEX(p_eventcount), key);
+
+    // Withdraw the waiter
+    __atomic_fetch_sub(&p_eventcount->_state, 1, __ATOMIC_RELAXED);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
         {
+            no_eventcount:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_eventcount\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-            #ifdef _WIN64
-                no_spinlock:
-                    #ifndef NDEBUG
-                        log_error("[sync] Invalid parameter provided for \"_spinlock\" in call to function \"%s\"\n", __FUNCTION__);
-                    #endif
+                // Error
+                return 0;
+        }
+    }
+}
 
-                    // Error
-                    return 0;
-            #endif
+int ec_notify_slow ( eventcount *p_eventcount, int count )
+{
+
+    // Argument check
+    if ( p_eventcount == (void *) 0 ) goto no_eventcount;
+
+    // Start a new epoch, so prepared waiters don't sleep
+    __atomic_fetch_add(&p_eventcount->_state, SYNC_EVENTCOUNT_EPOCH, __ATOMIC_SEQ_CST);
+
+    // Wake the sleeping waiters
+    sync_futex_wake(SYNC_EVENTCOUNT_FUTEX(p_eventcount), count);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_eventcount:
+                #ifndef NDEBUG
+                    log_error("[sync] Null pointer provided for \"p_eventcount\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
         }
     }
 }
 
-int spinlock_destroy ( spinlock *p_spinlock )
+int ec_destroy ( eventcount *p_eventcount )
 {
 
     // Argument check
-    if ( p_spinlock == (void *) 0 ) goto no_spinlock;
+    if ( p_eventcount == (void *) 0 ) goto no_eventcount;
 
-    // Platform dependent implementation
-    #ifdef _WIN64
-    #else
+    // Error check
+    if ( __atomic_load_n(&p_eventcount->_state, __ATOMIC_ACQUIRE) & UINT32_MAX ) goto eventcount_waited;
 
-        // Return
-        return ( pthread_spin_destroy(p_spinlock) == 0 );
-    #endif
+    // Success
+    return 1;
 
     // Error handling
     {
         
         // Argument errors
         {
-            no_spinlock:
+            no_eventcount:
                 #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_spinlock\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[sync] Null pointer provided for \"p_eventcount\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
         }
+
+        // Sync errors
+        {
+            eventcount_waited:
+                #ifndef NDEBUG
+                    log_error("[sync] Eventcount destroyed with waiters in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+#endif
+
+#ifdef BUILD_SYNC_WITH_POOL
+/** !
+ * Draw a random number for a worker
+ * 
+ * @param p_worker the worker
+ * 
+ * @return a random number
+ */
+static inline uint64_t sync_pool_random ( struct sync_pool_worker_s *p_worker )
+{
+
+    // Initialized data
+    uint64_t x = p_worker->random;
+
+    // Xorshift
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+
+    // Store the state
+    p_worker->random = x;
+
+    // Success
+    return x;
+}
+
+/** !
+ * Double the array of a worker's deque. The old array stays alive,
+ * because thieves may still read it, and is freed with the pool
+ * 
+ * @param p_worker the worker
+ * @param top      the top of the deque
+ * @param bottom   the bottom of the deque
+ * 
+ * @return the new array on success, null on error
+ */
+static struct sync_pool_array_s *sync_pool_grow ( struct sync_pool_worker_s *p_worker, int64_t top, int64_t bottom )
+{
+
+    // Initialized data
+    struct sync_pool_array_s *p_array = p_worker->p_array,
+                             *p_new   = malloc(sizeof(struct sync_pool_array_s) + 2 * p_array->size * sizeof(struct sync_pool_task_s));
+
+    // Error check
+    if ( p_new == (void *) 0 ) return (void *) 0;
+
+    // Populate the array
+    p_new->size       = 2 * p_array->size;
+    p_new->p_previous = p_array;
+
+    // Copy the tasks
+    for (int64_t i = top; i < bottom; i++) p_new->tasks[(size_t) i & ( p_new->size - 1 )] = p_array->tasks[(size_t) i & ( p_array->size - 1 )];
+
+    // Publish the array
+    __atomic_store_n(&p_worker->p_array, p_new, __ATOMIC_RELEASE);
+
+    // Success
+    return p_new;
+}
+
+/** !
+ * Push a task onto the bottom of the caller's deque
+ * 
+ * @param p_worker           the caller's worker
+ * @param pfn_sync_pool_task the task
+ * @param p_parameter        the parameter of the task
+ * 
+ * @return true on success, false on error
+ */
+static bool sync_pool_push ( struct sync_pool_worker_s *p_worker, fn_sync_pool_task *pfn_sync_pool_task, void *p_parameter )
+{
+
+    // Initialized data
+    int64_t bottom = __atomic_load_n(&p_worker->bottom, __ATOMIC_RELAXED),
+            top    = __atomic_load_n(&p_worker->top, __ATOMIC_ACQUIRE);
+    struct sync_pool_array_s *p_array = p_worker->p_array;
+    struct sync_pool_task_s *p_task = (void *) 0;
+
+    // The deque is full
+    if ( bottom - top >= (int64_t) p_array->size )
+        if ( ( p_array = sync_pool_grow(p_worker, top, bottom) ) == (void *) 0 ) return false;
+
+    // Store the task
+    p_task = &p_array->tasks[(size_t) bottom & ( p_array->size - 1 )];
+    __atomic_store_n(&p_task->pfn_sync_pool_task, pfn_sync_pool_task, __ATOMIC_RELAXED);
+    __atomic_store_n(&p_task->p_parameter, p_parameter, __ATOMIC_RELAXED);
+
+    // Publish the task
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&p_worker->bottom, bottom + 1, __ATOMIC_RELAXED);
+
+    // Success
+    return true;
+}
+
+/** !
+ * Pop a task from the bottom of the caller's deque
+ * 
+ * @param p_worker the caller's worker
+ * @param p_task   return the task
+ * 
+ * @return true if the caller took a task, else false
+ */
+static bool sync_pool_pop ( struct sync_pool_worker_s *p_worker, struct sync_pool_task_s *p_task )
+{
+
+    // Initialized data
+    int64_t bottom = __atomic_load_n(&p_worker->bottom, __ATOMIC_RELAXED) - 1,
+            top    = 0;
+    struct sync_pool_array_s *p_array = p_worker->p_array;
+    bool taken = true;
+
+    // Claim the bottom task, then look for thieves
+    __atomic_store_n(&p_worker->bottom, bottom, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    top = __atomic_load_n(&p_worker->top, __ATOMIC_RELAXED);
+
+    // The deque is empty
+    if ( top > bottom )
+    {
+        __atomic_store_n(&p_worker->bottom, bottom + 1, __ATOMIC_RELAXED);
+        return false;
+    }
+
+    // Read the task
+    *p_task = p_array->tasks[(size_t) bottom & ( p_array->size - 1 )];
+
+    // The last task. Race the thieves for it
+    if ( top == bottom )
+    {
+        taken = __atomic_compare_exchange_n(&p_worker->top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+        __atomic_store_n(&p_worker->bottom, bottom + 1, __ATOMIC_RELAXED);
+    }
+
+    // Done
+    return taken;
+}
+
+/** !
+ * Steal a task from the top of a victim's deque
+ * 
+ * @param p_victim the victim
+ * @param p_task   return the task
+ * 
+ * @return true if the caller took a task, else false
+ */
+static bool sync_pool_steal ( struct sync_pool_worker_s *p_victim, struct sync_pool_task_s *p_task )
+{
+
+    // Initialized data
+    int64_t top    = __atomic_load_n(&p_victim->top, __ATOMIC_ACQUIRE),
+            bottom = 0;
+    struct sync_pool_array_s *p_array = (void *) 0;
+    struct sync_pool_task_s *p_slot = (void *) 0;
+
+    // Order the top before the bottom
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    bottom = __atomic_load_n(&p_victim->bottom, __ATOMIC_ACQUIRE);
+
+    // The deque is empty
+    if ( top >= bottom ) return false;
+
+    // Read the task
+    p_array = __atomic_load_n(&p_victim->p_array, __ATOMIC_ACQUIRE);
+    p_slot  = &p_array->tasks[(size_t) top & ( p_array->size - 1 )];
+    p_task->pfn_sync_pool_task = __atomic_load_n(&p_slot->pfn_sync_pool_task, __ATOMIC_RELAXED);
+    p_task->p_parameter        = __atomic_load_n(&p_slot->p_parameter, __ATOMIC_RELAXED);
+
+    // Claim the task
+    return __atomic_compare_exchange_n(&p_victim->top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+}
+
+/** !
+ * Add a task to the shared queue of a thread pool
+ * 
+ * @param p_sync_pool        the thread pool
+ * @param pfn_sync_pool_task the task
+ * @param p_parameter        the parameter of the task
+ * 
+ * @return true on success, false on error
+ */
+static bool sync_pool_inject ( struct sync_pool_s *p_sync_pool, fn_sync_pool_task *pfn_sync_pool_task, void *p_parameter )
+{
+
+    // Lock
+    sync_word_lock(&p_sync_pool->lock);
+
+    // The queue is full
+    if ( p_sync_pool->inject_quantity == p_sync_pool->inject_size )
+    {
+
+        // Initialized data
+        size_t size = p_sync_pool->inject_size ? 2 * p_sync_pool->inject_size : SYNC_POOL_INJECT;
+        struct sync_pool_task_s *p_inject = malloc(size * sizeof(struct sync_pool_task_s));
+
+        // Error check
+        if ( p_inject == (void *) 0 )
+        {
+            sync_word_unlock(&p_sync_pool->lock);
+            return false;
+        }
+
+        // Copy the queue in order
+        for (size_t i = 0; i < p_sync_pool->inject_quantity; i++)
+            p_inject[i] = p_sync_pool->p_inject[( p_sync_pool->inject_head + i ) & ( p_sync_pool->inject_size - 1 )];
+
+        // Replace the queue
+        free(p_sync_pool->p_inject);
+        p_sync_pool->p_inject    = p_inject;
+        p_sync_pool->inject_size = size;
+        p_sync_pool->inject_head = 0;
+    }
+
+    // Store the task
+    p_sync_pool->p_inject[( p_sync_pool->inject_head + p_sync_pool->inject_quantity ) & ( p_sync_pool->inject_size - 1 )] = (struct sync_pool_task_s)
+    {
+        .pfn_sync_pool_task = pfn_sync_pool_task,
+        .p_parameter        = p_parameter
+    };
+    __atomic_store_n(&p_sync_pool->inject_quantity, p_sync_pool->inject_quantity + 1, __ATOMIC_RELAXED);
+
+    // Unlock
+    sync_word_unlock(&p_sync_pool->lock);
+
+    // Success
+    return true;
+}
+
+/** !
+ * Take a task from the shared queue of a thread pool
+ * 
+ * @param p_sync_pool the thread pool
+ * @param p_task      return the task
+ * 
+ * @return true if the caller took a task, else false
+ */
+static bool sync_pool_take ( struct sync_pool_s *p_sync_pool, struct sync_pool_task_s *p_task )
+{
+
+    // Initialized data
+    bool taken = false;
+
+    // Fast path. The queue is empty
+    if ( __atomic_load_n(&p_sync_pool->inject_quantity, __ATOMIC_RELAXED) == 0 ) return false;
+
+    // Lock
+    sync_word_lock(&p_sync_pool->lock);
+
+    // Take the task at the head
+    if ( p_sync_pool->inject_quantity )
+    {
+        *p_task = p_sync_pool->p_inject[p_sync_pool->inject_head];
+        p_sync_pool->inject_head = ( p_sync_pool->inject_head + 1 ) & ( p_sync_pool->inject_size - 1 );
+        __atomic_store_n(&p_sync_pool->inject_quantity, p_sync_pool->inject_quantity - 1, __ATOMIC_RELAXED);
+        taken = true;
+    }
+
+    // Unlock
+    sync_word_unlock(&p_sync_pool->lock);
+
+    // Done
+    return taken;
+}
+
+/** !
+ * Find a task for a worker. Pop the worker's own deque, then take 
+ * from the shared queue, then steal from random victims, starting 
+ * with workers on the same NUMA node
+ * 
+ * @param p_worker the worker
+ * @param p_task   return the task
+ * 
+ * @return true if the worker found a task, else false
+ */
+static bool sync_pool_find ( struct sync_pool_worker_s *p_worker, struct sync_pool_task_s *p_task )
+{
+
+    // Initialized data
+    struct sync_pool_s *p_sync_pool = p_worker->p_sync_pool;
+    size_t workers = p_sync_pool->workers;
+
+    // The worker's own deque
+    if ( sync_pool_pop(p_worker, p_task) ) return true;
+
+    // The shared queue
+    if ( sync_pool_take(p_sync_pool, p_task) ) return true;
+
+    // Steal
+    for (size_t i = 0; i < workers; i++)
+    {
+
+        // Initialized data
+        size_t victim = ( i < p_worker->node_quantity )
+                      ? p_sync_pool->p_order[p_worker->node_first + sync_pool_random(p_worker) % p_worker->node_quantity]
+                      : (size_t) ( sync_pool_random(p_worker) % workers );
+
+        // Don't steal from the worker's own deque
+        if ( victim == p_worker->index ) continue;
+
+        // Steal
+        if ( sync_pool_steal(&p_sync_pool->p_workers[victim], p_task) ) return true;
+    }
+
+    // Done
+    return false;
+}
+
+/** !
+ * Check a thread pool for tasks
+ * 
+ * @param p_sync_pool the thread pool
+ * 
+ * @return true if any queue holds a task, else false
+ */
+static bool sync_pool_has_work ( struct sync_pool_s *p_sync_pool )
+{
+
+    // The shared queue
+    if ( __atomic_load_n(&p_sync_pool->inject_quantity, __ATOMIC_RELAXED) ) return true;
+
+    // Every deque
+    for (size_t i = 0; i < p_sync_pool->workers; i++)
+        if ( __atomic_load_n(&p_sync_pool->p_workers[i].top, __ATOMIC_ACQUIRE) < __atomic_load_n(&p_sync_pool->p_workers[i].bottom, __ATOMIC_ACQUIRE) ) return true;
+
+    // Done
+    return false;
+}
+
+/** !
+ * Run tasks until the pool shuts down. Spin briefly when there is 
+ * nothing to do, then park on the pool's eventcount
+ * 
+ * @param p_worker the worker
+ * 
+ * @return void
+ */
+static void sync_pool_work ( struct sync_pool_worker_s *p_worker )
+{
+
+    // Initialized data
+    struct sync_pool_s *p_sync_pool = p_worker->p_sync_pool;
+    struct sync_pool_task_s task = { 0 };
+    unsigned int spins = 0;
+
+    // Allocate the deque on the worker's thread. A pinned worker 
+    // touches it first, so it lands on the worker's node
+    if ( ( p_worker->p_array = malloc(sizeof(struct sync_pool_array_s) + SYNC_POOL_DEQUE * sizeof(struct sync_pool_task_s)) ) )
+    {
+        p_worker->p_array->size       = SYNC_POOL_DEQUE;
+        p_worker->p_array->p_previous = (void *) 0;
+    }
+
+    // Tell the creator the worker is ready
+    latch_count_down(&p_sync_pool->ready, 1);
+
+    // Error check
+    if ( p_worker->p_array == (void *) 0 ) return;
+
+    // Let tasks submit to this worker's deque
+    p_sync_pool_worker = p_worker;
+
+    for (;;)
+    {
+
+        // Initialized data
+        uint32_t key = 0;
+
+        // Run a task
+        if ( sync_pool_find(p_worker, &task) )
+        {
+            task.pfn_sync_pool_task(task.p_parameter);
+            latch_count_down(&p_sync_pool->pending, 1);
+            spins = 0;
+            continue;
+        }
+
+        // Spin
+        if ( sync_processors > 1 && spins < SYNC_POOL_SPIN )
+        {
+            sync_pause();
+            spins++;
+            continue;
+        }
+
+        // The pool shut down
+        if ( __atomic_load_n(&p_sync_pool->shutdown, __ATOMIC_ACQUIRE) ) break;
+
+        // Prepare to park, then look again
+        key = ec_prepare_wait(&p_sync_pool->idle);
+        if ( sync_pool_has_work(p_sync_pool) || __atomic_load_n(&p_sync_pool->shutdown, __ATOMIC_ACQUIRE) )
+        {
+            ec_cancel_wait(&p_sync_pool->idle);
+            continue;
+        }
+
+        // Park
+        ec_wait(&p_sync_pool->idle, key);
+        spins = 0;
     }
+
+    // Done
+    return;
+}
+
+#ifdef _WIN64
+static DWORD WINAPI sync_pool_thread ( LPVOID p_parameter )
+{
+
+    // Work
+    sync_pool_work(p_parameter);
+
+    // Success
+    return 0;
+}
+#else
+static void *sync_pool_thread ( void *p_parameter )
+{
+
+    // Work
+    sync_pool_work(p_parameter);
+
+    // Success
+    return (void *) 0;
 }
 #endif
 
-#ifdef BUILD_SYNC_WITH_RW_LOCK
-int rwlock_create ( rwlock *p_rwlock )
+/** !
+ * Read the processors the caller may run on, and the NUMA node of each
+ * 
+ * @param p_cpus  return the processors
+ * @param p_nodes return the node of each processor
+ * 
+ * @return the quantity of processors
+ */
+static size_t sync_pool_processors ( int *p_cpus, int *p_nodes )
 {
-    // Argument check
-    if ( p_rwlock == (void *) 0 ) goto no_rwlock;
+
+    // Initialized data
+    size_t quantity = 0;
 
     // Platform dependent implementation
-    #ifdef _WIN64
-    #else
+    #ifdef __linux__
+    {
 
-        // Return
-        return ( pthread_rwlock_init(p_rwlock, NULL) == 0 );
-    #endif
+        // Initialized data
+        int node_of[SYNC_POOL_MAX_PROCESSORS];
+        cpu_set_t allowed;
+        DIR *p_dir = opendir("/sys/devices/system/node");
+        struct dirent *p_entry = (void *) 0;
 
-    // Error handling
-    {
-        
-        // Argument errors
+        // Every processor is on node 0, unless sysfs says otherwise
+        memset(node_of, 0, sizeof(node_of));
+
+        // Read the processors of each node
+        while ( p_dir && ( p_entry = readdir(p_dir) ) )
         {
-            no_rwlock:
-                #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_rwlock\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
 
-                // Error
-                return 0;
+            // Initialized data
+            char path[300] = { 0 };
+            int node = 0, first = 0, last = 0, c = 0;
+            FILE *p_f = (void *) 0;
+
+            // Skip entries that aren't nodes
+            if ( sscanf(p_entry->d_name, "node%d", &node) != 1 ) continue;
+
+            // Open the processor list, like "0-3,8-11"
+            snprintf(path, sizeof(path), "/sys/devices/system/node/%s/cpulist", p_entry->d_name);
+            if ( ( p_f = fopen(path, "r") ) == (void *) 0 ) continue;
+
+            // Parse each range
+            while ( fscanf(p_f, "%d", &first) == 1 )
+            {
+
+                // The end of the range
+                last = first;
+                if ( ( c = fgetc(p_f) ) == '-' )
+                {
+                    if ( fscanf(p_f, "%d", &last) != 1 ) break;
+                    c = fgetc(p_f);
+                }
+
+                // Store the node of each processor
+                for (int cpu = first; cpu <= last && cpu < SYNC_POOL_MAX_PROCESSORS; cpu++) if ( cpu >= 0 ) node_of[cpu] = node;
+
+                // The last range
+                if ( c != ',' ) break;
+            }
+
+            // Close the processor list
+            fclose(p_f);
         }
+
+        // Close the node directory
+        if ( p_dir ) closedir(p_dir);
+
+        // Read the processors the caller may run on
+        if ( sched_getaffinity(0, sizeof(allowed), &allowed) == 0 )
+            for (int cpu = 0; cpu < SYNC_POOL_MAX_PROCESSORS && cpu < CPU_SETSIZE; cpu++)
+                if ( CPU_ISSET((size_t) cpu, &allowed) ) p_cpus[quantity] = cpu, p_nodes[quantity] = node_of[cpu], quantity++;
     }
+    #endif
+
+    // Fall back to every processor on one node
+    if ( quantity == 0 )
+        for (long cpu = 0; cpu < sync_processors && cpu < SYNC_POOL_MAX_PROCESSORS; cpu++)
+            p_cpus[quantity] = (int) cpu, p_nodes[quantity] = 0, quantity++;
+
+    // Success
+    return quantity;
 }
 
-int rwlock_lock_rd ( rwlock *p_rwlock )
+/** !
+ * Order processors for an affinity policy
+ * 
+ * @param p_cpus   the processors
+ * @param p_nodes  the node of each processor
+ * @param quantity the quantity of processors
+ * @param affinity the affinity policy
+ * 
+ * @return void
+ */
+static void sync_pool_order ( int *p_cpus, int *p_nodes, size_t quantity, sync_pool_affinity affinity )
 {
-    // Argument check
-    if ( p_rwlock == (void *) 0 ) goto no_rwlock;
 
-    // Platform dependent implementation
-    #ifdef _WIN64
-    #else
+    // Fill each node before the next
+    for (size_t i = 1; i < quantity; i++)
+        for (size_t j = i; j > 0 && p_nodes[j - 1] > p_nodes[j]; j--)
+        {
 
-        // Return
-        return ( pthread_rwlock_rdlock(p_rwlock) == 0 );
-    #endif
+            // Initialized data
+            int cpu = p_cpus[j], node = p_nodes[j];
 
-    // Error handling
+            // Swap
+            p_cpus[j]  = p_cpus[j - 1], p_nodes[j]  = p_nodes[j - 1];
+            p_cpus[j - 1] = cpu,        p_nodes[j - 1] = node;
+        }
+
+    // Deal processors across the nodes in turn
+    if ( affinity == SYNC_POOL_AFFINITY_SCATTER )
     {
-        
-        // Argument errors
-        {
-            no_rwlock:
-                #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_rwlock\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
 
-                // Error
-                return 0;
-        }
+        // Initialized data
+        int cpus[SYNC_POOL_MAX_PROCESSORS], nodes[SYNC_POOL_MAX_PROCESSORS];
+        size_t out = 0;
+
+        // Each round takes the next processor of every node
+        for (size_t round = 0; out < quantity; round++)
+            for (size_t first = 0, last = 0; first < quantity; first = last + 1)
+            {
+
+                // Find the end of the node
+                for (last = first; last + 1 < quantity && p_nodes[last + 1] == p_nodes[first]; last++);
+
+                // Deal the processor
+                if ( first + round <= last ) cpus[out] = p_cpus[first + round], nodes[out] = p_nodes[first + round], out++;
+            }
+
+        // Copy the order
+        memcpy(p_cpus, cpus, quantity * sizeof(int));
+        memcpy(p_nodes, nodes, quantity * sizeof(int));
     }
+
+    // Done
+    return;
 }
 
-int rwlock_lock_wr ( rwlock *p_rwlock )
+/** !
+ * Stop the workers of a thread pool
+ * 
+ * @param p_sync_pool the thread pool
+ * @param started     the quantity of workers that started
+ * 
+ * @return void
+ */
+static void sync_pool_stop ( struct sync_pool_s *p_sync_pool, size_t started )
 {
-    // Argument check
-    if ( p_rwlock == (void *) 0 ) goto no_rwlock;
-
-    // Platform dependent implementation
-    #ifdef _WIN64
-    #else
 
-        // Return
-        return ( pthread_rwlock_wrlock(p_rwlock) == 0 );
-    #endif
+    // Shut down, and wake every parked worker
+    __atomic_store_n(&p_sync_pool->shutdown, true, __ATOMIC_RELEASE);
+    ec_notify_all(&p_sync_pool->idle);
 
-    // Error handling
+    // Join the workers
+    for (size_t i = 0; i < started; i++)
     {
-        
-        // Argument errors
-        {
-            no_rwlock:
-                #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_rwlock\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error
-                return 0;
-        }
+        #ifdef _WIN64
+            WaitForSingleObject(p_sync_pool->p_workers[i].thread, INFINITE);
+            CloseHandle(p_sync_pool->p_workers[i].thread);
+        #else
+            pthread_join(p_sync_pool->p_workers[i].thread, (void *) 0);
+        #endif
     }
+
+    // Done
+    return;
 }
 
-int rwlock_lock_timeout_rd ( rwlock *p_rwlock, timestamp _time )
+/** !
+ * Free a thread pool, and every array its deques ever used
+ * 
+ * @param p_sync_pool the thread pool
+ * 
+ * @return void
+ */
+static void sync_pool_free ( struct sync_pool_s *p_sync_pool )
 {
-    // Argument check
-    if ( p_rwlock == (void *) 0 ) goto no_rwlock;
-    
-    // Platform dependent initialized data
-    #ifdef _WIN64
-    #else
-        struct timespec abstime = { 
-            .tv_sec  = _time * ( 1 / SEC_2_NS ),
-            .tv_nsec = _time % SEC_2_NS
-        };
-    #endif
 
-    // Platform dependent implementation
-    #ifdef _WIN64
-    #else
-
-        // Return
-        return ( pthread_rwlock_timedrdlock(p_rwlock, &abstime) == 0 );
-    #endif
+    // State check
+    if ( p_sync_pool == (void *) 0 ) return;
 
-    // Error handling
-    {
-        
-        // Argument errors
+    // Free the deques
+    for (size_t i = 0; p_sync_pool->p_workers && i < p_sync_pool->workers; i++)
+        for (struct sync_pool_array_s *p_array = p_sync_pool->p_workers[i].p_array, *p_previous = (void *) 0; p_array; p_array = p_previous)
         {
-            no_rwlock:
-                #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_rwlock\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error
-                return 0;
+            p_previous = p_array->p_previous;
+            free(p_array);
         }
-    }
+
+    // Free the pool
+    free(p_sync_pool->p_workers);
+    free(p_sync_pool->p_order);
+    free(p_sync_pool->p_inject);
+    free(p_sync_pool);
+
+    // Done
+    return;
 }
 
-int rwlock_lock_timeout_wr ( rwlock *p_rwlock, timestamp _time )
+int sync_pool_create ( sync_pool **pp_sync_pool, size_t workers )
 {
+
+    // Success
+    return sync_pool_create_affinity(pp_sync_pool, workers, SYNC_POOL_AFFINITY_NONE);
+}
+
+int sync_pool_create_affinity ( sync_pool **pp_sync_pool, size_t workers, sync_pool_affinity affinity )
+{
+
     // Argument check
-    if ( p_rwlock == (void *) 0 ) goto no_rwlock;
+    if ( pp_sync_pool == (void *) 0 ) goto no_sync_pool;
+    if ( (unsigned) affinity >= SYNC_POOL_AFFINITY_QUANTITY ) goto bad_affinity;
 
-    // Platform dependent initialized data
-    #ifdef _WIN64
-    #else
-        struct timespec abstime = { 
-            .tv_sec  = _time * ( 1 / SEC_2_NS ),
-            .tv_nsec = _time % SEC_2_NS
-        };
-    #endif
+    // Initialized data
+    int cpus[SYNC_POOL_MAX_PROCESSORS], nodes[SYNC_POOL_MAX_PROCESSORS];
+    size_t processors = sync_pool_processors(cpus, nodes),
+           started    = 0;
+    struct sync_pool_s *p_sync_pool = (void *) 0;
 
-    // Platform dependent implementation
-    #ifdef _WIN64
-    #else
+    // One worker per processor
+    if ( workers == 0 ) workers = processors;
 
-        // Return
-        return ( pthread_rwlock_timedwrlock(p_rwlock, &abstime) == 0 );
-    #endif
+    // Error check
+    if ( workers > SYNC_LATCH_COUNT || workers > SIZE_MAX / sizeof(struct sync_pool_worker_s) ) goto too_many_workers;
 
-    // Error handling
+    // Order the processors for the affinity policy
+    sync_pool_order(cpus, nodes, processors, affinity);
+
+    // Allocate the pool
+    if ( posix_memalign((void **)&p_sync_pool, SYNC_CACHE_LINE, sizeof(struct sync_pool_s)) ) goto no_mem;
+
+    // Zero set
+    memset(p_sync_pool, 0, sizeof(struct sync_pool_s));
+
+    // Populate the pool
+    p_sync_pool->workers = workers;
+    latch_create(&p_sync_pool->pending, 0);
+    latch_create(&p_sync_pool->ready, (unsigned int) workers);
+    ec_create(&p_sync_pool->idle);
+
+    // Allocate the workers
+    if ( posix_memalign((void **)&p_sync_pool->p_workers, SYNC_CACHE_LINE, workers * sizeof(struct sync_pool_worker_s)) ) 
     {
-        
-        // Argument errors
-        {
-            no_rwlock:
-                #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_rwlock\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+        p_sync_pool->p_workers = (void *) 0;
+        goto no_mem;
+    }
 
-                // Error
-                return 0;
-        }
+    // Zero set
+    memset(p_sync_pool->p_workers, 0, workers * sizeof(struct sync_pool_worker_s));
+
+    // Allocate the node order
+    if ( ( p_sync_pool->p_order = malloc(workers * sizeof(size_t)) ) == (void *) 0 ) goto no_mem;
+
+    // Populate each worker
+    for (size_t i = 0; i < workers; i++)
+    {
+
+        // Initialized data
+        struct sync_pool_worker_s *p_worker = &p_sync_pool->p_workers[i];
+
+        // Populate the worker. Unpinned workers share one node
+        p_worker->p_sync_pool = p_sync_pool;
+        p_worker->index       = i;
+        p_worker->random      = ( i + 1 ) * 0x9E3779B97F4A7C15ULL;
+        p_worker->cpu         = ( affinity == SYNC_POOL_AFFINITY_NONE ) ? -1 : cpus[i % processors];
+        p_worker->node        = ( affinity == SYNC_POOL_AFFINITY_NONE ) ?  0 : nodes[i % processors];
+        p_sync_pool->p_order[i] = i;
     }
-}
 
-int rwlock_unlock ( rwlock *p_rwlock )
-{
-    // Argument check
-    if ( p_rwlock == (void *) 0 ) goto no_rwlock;
+    // Group the workers by node
+    for (size_t i = 1; i < workers; i++)
+        for (size_t j = i; j > 0 && p_sync_pool->p_workers[p_sync_pool->p_order[j - 1]].node > p_sync_pool->p_workers[p_sync_pool->p_order[j]].node; j--)
+        {
 
-    // Platform dependent implementation
-    #ifdef _WIN64
-    #else
+            // Initialized data
+            size_t index = p_sync_pool->p_order[j];
 
-        // Return
-        return ( pthread_rwlock_unlock(p_rwlock) == 0 );
-    #endif
+            // Swap
+            p_sync_pool->p_order[j]     = p_sync_pool->p_order[j - 1];
+            p_sync_pool->p_order[j - 1] = index;
+        }
 
-    // Error handling
+    // Tell each worker where its node's workers are
+    for (size_t first = 0, last = 0; first < workers; first = last + 1)
     {
-        
-        // Argument errors
-        {
-            no_rwlock:
-                #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_rwlock\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
 
-                // Error
-                return 0;
+        // Find the end of the node
+        for (last = first; last + 1 < workers && p_sync_pool->p_workers[p_sync_pool->p_order[last + 1]].node == p_sync_pool->p_workers[p_sync_pool->p_order[first]].node; last++);
+
+        // Store the node
+        for (size_t i = first; i <= last; i++)
+        {
+            p_sync_pool->p_workers[p_sync_pool->p_order[i]].node_first    = first;
+            p_sync_pool->p_workers[p_sync_pool->p_order[i]].node_quantity = last - first + 1;
         }
     }
-}
 
-int rwlock_destroy ( rwlock *p_rwlock )
-{
+    // Start the workers
+    for (; started < workers; started++)
+    {
 
-    // Argument check
-    if ( p_rwlock == (void *) 0 ) goto no_rwlock;
+        // Initialized data
+        struct sync_pool_worker_s *p_worker = &p_sync_pool->p_workers[started];
 
-    // Platform dependent implementation
-    #ifdef _WIN64
-    #else
+        // Platform dependent implementation
+        #ifdef _WIN64
 
-        // Return
-        return ( pthread_rwlock_destroy(p_rwlock) == 0 );
-    #endif
+            // Start the worker, suspended
+            if ( ( p_worker->thread = CreateThread(NULL, 0, sync_pool_thread, p_worker, CREATE_SUSPENDED, NULL) ) == NULL ) goto failed_to_start;
 
-    // Error handling
-    {
-        
-        // Argument errors
+            // Pin the worker before it runs, so it allocates its deque on its own node
+            if ( p_worker->cpu >= 0 && p_worker->cpu < 64 ) SetThreadAffinityMask(p_worker->thread, (DWORD_PTR) 1 << p_worker->cpu);
+
+            // Run the worker
+            ResumeThread(p_worker->thread);
+        #else
         {
-            no_rwlock:
-                #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_rwlock\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
 
-                // Error
-                return 0;
-        }
-    }
-}
-#endif
+            // Initialized data
+            pthread_attr_t attributes;
+            int result = 0;
 
-#ifdef BUILD_SYNC_WITH_SEMAPHORE
-int semaphore_create ( semaphore *p_semaphore, unsigned int count )
-{
+            // Pin the worker before it runs, so it allocates its deque on its own node
+            pthread_attr_init(&attributes);
+            #ifdef __linux__
+                if ( p_worker->cpu >= 0 )
+                {
 
-    // Argument check
-    if ( p_semaphore == (void *) 0 ) goto no_semaphore;
-    
-    // Platform dependent implementation
-    #ifdef _WIN64
+                    // Initialized data
+                    cpu_set_t set;
 
-        // Create a semaphore with the specified count
-        *p_semaphore = CreateSemaphore(NULL, count, count, NULL);
+                    // Pin
+                    CPU_ZERO(&set);
+                    CPU_SET((size_t) p_worker->cpu, &set);
+                    pthread_attr_setaffinity_np(&attributes, sizeof(set), &set);
+                }
+            #endif
 
-        // Return
-        return ( p_semaphore != 0 );
-    #else
+            // Start the worker
+            result = pthread_create(&p_worker->thread, &attributes, sync_pool_thread, p_worker);
+            pthread_attr_destroy(&attributes);
 
-        // Return
-        return ( sem_init(p_semaphore, 0, count) == 0 );
-    #endif
+            // Error check
+            if ( result ) goto failed_to_start;
+        }
+        #endif
+    }
+
+    // Wait for each worker to allocate its deque
+    latch_wait(&p_sync_pool->ready);
+
+    // Error check
+    for (size_t i = 0; i < workers; i++)
+        if ( p_sync_pool->p_workers[i].p_array == (void *) 0 ) goto no_deque;
+
+    // Return a pointer to the caller
+    *pp_sync_pool = p_sync_pool;
+
+    // Success
+    return 1;
 
     // Error handling
     {
         
         // Argument errors
         {
-            no_semaphore:
+            no_sync_pool:
                 #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_semaphore\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[sync] [pool] Null pointer provided for parameter \"pp_sync_pool\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
-        }
-    }
-}
 
-int semaphore_wait ( semaphore _semaphore )
-{
+            bad_affinity:
+                #ifndef NDEBUG
+                    log_error("[sync] [pool] Parameter \"affinity\" must be less than %d in call to function \"%s\"\n", SYNC_POOL_AFFINITY_QUANTITY, __FUNCTION__);
+                #endif
 
-    // Platform dependent implementation
-    #ifdef _WIN64
-        
-        // Platform dependent argument check
-        if ( _semaphore == INVALID_HANDLE_VALUE ) goto no_semaphore;
-        
-        // Return
-        return ( WaitForSingleObject(_semaphore, INFINITE) == WAIT_FAILED ? 0 : 1 );
-    #else
+                // Error
+                return 0;
 
-        // Return
-        return ( sem_wait(&_semaphore) == 0 );
-    #endif
+            too_many_workers:
+                #ifndef NDEBUG
+                    log_error("[sync] [pool] Parameter \"workers\" is too large in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-    // Error handling
-    {
+                // Error
+                return 0;
+        }
 
-        // Argument error
+        // Pool errors
         {
-            #ifdef _WIN64
-                no_semaphore:
-                    #ifndef NDEBUG
-                        log_error("[sync] Invalid parameter provided for \"_semaphore\" in call to function \"%s\"\n", __FUNCTION__);
-                    #endif
-
-                    // Error
-                    return 0;
-            #endif
-        }
-    }
-}
+            failed_to_start:
+                #ifndef NDEBUG
+                    log_error("[sync] [pool] Failed to start a worker in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-int semaphore_signal ( semaphore _semaphore )
-{
+                // Stop the workers that started
+                sync_pool_stop(p_sync_pool, started);
 
-    // Platform dependent implementation
-    #ifdef _WIN64
+                // Free the pool
+                sync_pool_free(p_sync_pool);
 
-        // Platform dependent argument check
-        if ( _semaphore == INVALID_HANDLE_VALUE ) goto no_semaphore;
+                // Error
+                return 0;
+        }
 
-        // Return
-        return ( ReleaseSemaphore(_semaphore, 1, 0) );
-    #else
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-        // Return
-        return ( sem_post(&_semaphore) == 0 );
-    #endif
+                // Free the pool
+                sync_pool_free(p_sync_pool);
 
+                // Error
+                return 0;
 
+            no_deque:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-    // Error handling
-    {
+                // Stop the workers
+                sync_pool_stop(p_sync_pool, started);
 
-        // Argument errors
-        {
-            #ifdef _WIN64
-                no_semaphore:
-                    #ifndef NDEBUG
-                        log_error("[sync] Invalid parameter provided for \"_semaphore\" in call to function \"%s\"\n", __FUNCTION__);
-                    #endif
+                // Free the pool
+                sync_pool_free(p_sync_pool);
 
-                    // Error
-                    return 0;
-            #endif
+                // Error
+                return 0;
         }
     }
 }
 
-int semaphore_destroy ( semaphore *p_semaphore )
+int sync_pool_submit ( sync_pool *p_sync_pool, fn_sync_pool_task *pfn_sync_pool_task, void *p_parameter )
 {
 
     // Argument check
-    if ( p_semaphore == (void *) 0 ) goto no_semaphore;
+    if ( p_sync_pool        == (void *) 0 ) goto no_sync_pool;
+    if ( pfn_sync_pool_task == (void *) 0 ) goto no_task;
 
-    // Platform dependent implementation
-    #ifdef _WIN64
+    // Initialized data
+    bool queued = false;
 
-        // Return
-        return ( CloseHandle(*p_semaphore) );
-    #else
+    // Count the task
+    if ( latch_add(&p_sync_pool->pending, 1) == 0 ) goto too_many_tasks;
 
-        // Return
-        return ( sem_destroy(p_semaphore) == 0 );
-    #endif
+    // A task submits to its worker's deque. Other threads submit to the shared queue
+    if ( p_sync_pool_worker && p_sync_pool_worker->p_sync_pool == p_sync_pool ) queued = sync_pool_push(p_sync_pool_worker, pfn_sync_pool_task, p_parameter);
+    else                                                                         queued = sync_pool_inject(p_sync_pool, pfn_sync_pool_task, p_parameter);
+
+    // Error check
+    if ( queued == false ) goto no_mem;
+
+    // Wake a parked worker
+    ec_notify(&p_sync_pool->idle);
+
+    // Success
+    return 1;
 
     // Error handling
     {
         
         // Argument errors
         {
-            no_semaphore:
+            no_sync_pool:
                 #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_semaphore\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[sync] [pool] Null pointer provided for parameter \"p_sync_pool\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
         }
-    }
-}
-#endif
 
-#ifdef BUILD_SYNC_WITH_CONDITION_VARIABLE
-int condition_variable_create ( condition_variable *p_condition_variable )
-{
+        // Argument errors
+        {
+            no_task:
+                #ifndef NDEBUG
+                    log_error("[sync] [pool] Null pointer provided for parameter \"pfn_sync_pool_task\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-    // Argument check
-    if ( p_condition_variable == (void *) 0 ) goto no_condition_variable;
-    
-    // Platform dependent implementation
-    #ifdef _WIN64
-    #else
+                // Error
+                return 0;
+        }
 
-        // Return
-        return ( pthread_cond_init(p_condition_variable, NULL) == 0 );
-    #endif
+        // Pool errors
+        {
+            too_many_tasks:
+                #ifndef NDEBUG
+                    log_error("[sync] [pool] Too many pending tasks in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-    // Error handling
-    {
-        
-        // Argument errors
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
         {
-            no_condition_variable:
+            no_mem:
                 #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_condition_variable\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
+                // Uncount the task
+                latch_count_down(&p_sync_pool->pending, 1);
+
                 // Error
                 return 0;
         }
     }
 }
 
-int condition_variable_wait ( condition_variable *p_condition_variable, mutex *p_mutex )
+int sync_pool_wait ( sync_pool *p_sync_pool )
 {
 
     // Argument check
-    if ( p_condition_variable == (void *) 0 ) goto no_condition_variable;
-    if ( p_mutex              == (void *) 0 ) goto no_mutex;
+    if ( p_sync_pool == (void *) 0 ) goto no_sync_pool;
 
-    // Platform dependent implementation
-    #ifdef _WIN64
-    #else
+    // State check
+    if ( p_sync_pool_worker && p_sync_pool_worker->p_sync_pool == p_sync_pool ) goto called_from_task;
 
-        // Return
-        return ( pthread_cond_wait(p_condition_variable, p_mutex) == 0 );
-    #endif
+    // Wait for the pending tasks
+    latch_wait(&p_sync_pool->pending);
+
+    // Success
+    return 1;
 
     // Error handling
     {
         
         // Argument errors
         {
-            no_condition_variable:
+            no_sync_pool:
                 #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_condition_variable\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[sync] [pool] Null pointer provided for parameter \"p_sync_pool\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
-                
-            no_mutex:
+        }
+
+        // Pool errors
+        {
+            called_from_task:
                 #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_mutex\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[sync] [pool] A task can not wait for its own pool in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -749,48 +7880,53 @@ int condition_variable_wait ( condition_variable *p_condition_variable, mutex *p
     }
 }
 
-int condition_variable_wait_timeout ( condition_variable *p_condition_variable, mutex *p_mutex, timestamp _time )
+int sync_pool_destroy ( sync_pool **pp_sync_pool )
 {
 
     // Argument check
-    if ( p_condition_variable == (void *) 0 ) goto no_condition_variable;
-    if ( p_mutex              == (void *) 0 ) goto no_mutex;
-    
-    // Platform dependent initialized data
-    #ifdef _WIN64
-    #else
-        struct timespec abstime = { 
-            .tv_sec  = _time * ( 1 / SEC_2_NS ),
-            .tv_nsec = _time % SEC_2_NS
-        };
-    #endif
+    if ( pp_sync_pool == (void *) 0 ) goto no_sync_pool;
+    if ( *pp_sync_pool == (void *) 0 ) goto no_sync_pool;
 
-    // Platform dependent implementation
-    #ifdef _WIN64
+    // Initialized data
+    sync_pool *p_sync_pool = *pp_sync_pool;
 
-        // TODO
-    #else
+    // State check
+    if ( p_sync_pool_worker && p_sync_pool_worker->p_sync_pool == p_sync_pool ) goto called_from_task;
 
-        // Return
-        return ( pthread_cond_timedwait(p_condition_variable, p_mutex, &abstime) == 0 );
-    #endif
+    // Wait for the pending tasks
+    latch_wait(&p_sync_pool->pending);
+
+    // Stop the workers
+    sync_pool_stop(p_sync_pool, p_sync_pool->workers);
+
+    // Free the pool
+    sync_pool_free(p_sync_pool);
+
+    // No more pointer for caller
+    *pp_sync_pool = (void *) 0;
+
+    // Success
+    return 1;
 
     // Error handling
     {
         
         // Argument errors
         {
-            no_condition_variable:
+            no_sync_pool:
                 #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_condition_variable\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[sync] [pool] Null pointer provided for parameter \"p_sync_pool\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
-                
-            no_mutex:
+        }
+
+        // Pool errors
+        {
+            called_from_task:
                 #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_mutex\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[sync] [pool] A task can not wait for its own pool in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -798,53 +7934,176 @@ int condition_variable_wait_timeout ( condition_variable *p_condition_variable,
         }
     }
 }
+#endif
 
-int condition_variable_signal ( condition_variable *p_condition_variable )
+#ifdef BUILD_SYNC_WITH_TIMER
+timestamp timer_high_precision ( void )
 {
+    
+    // Initialized data
+    timestamp ret = 0;
 
     // Platform dependent implementation
     #ifdef _WIN64
+
+        // Query the performance counter
+        QueryPerformanceCounter((LARGE_INTEGER *)&ret);
     #else
 
-        // Return
-        return pthread_cond_signal(p_condition_variable);
+        // Read the time stamp counter
+        #ifdef SYNC_TIMER_TSC
+
+            // Calibrate on first use
+            sync_once(&timer_tsc_once, timer_tsc_init, (void *) 0);
+
+            // The time stamp counter is usable
+            if ( timer_tsc )
+            {
+
+                // Initialized data
+                unsigned int aux = 0;
+
+                // Done
+                return (timestamp) __rdtscp(&aux);
+            }
+        #endif
+
+        // Initialized data
+        struct timespec ts;
+
+        // Populate the time struct using the monotonic timer
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+
+        // Compute the monotonic time in nanoseconds
+        ret = ( (timestamp) ts.tv_sec * SEC_2_NS ) + ( (timestamp) ts.tv_nsec );
     #endif
+
+    // Error
+    return ret;
 }
 
-int condition_variable_broadcast ( condition_variable *p_condition_variable )
+timestamp timer_seconds_divisor ( void )
 {
 
-    // Platform dependent implementation
-    #ifdef _WIN64
-    #else
-
-        // Return
-        return pthread_cond_broadcast(p_condition_variable);
+    // Calibrate the time stamp counter on first use
+    #ifdef SYNC_TIMER_TSC
+        sync_once(&timer_tsc_once, timer_tsc_init, (void *) 0);
     #endif
+
+    // Done
+    return SYNC_TIMER_DIVISOR;
 }
 
-int condition_variable_destroy ( condition_variable *p_condition_variable )
+/** !
+ * Compute the index of the bucket a value is recorded in. Values 
+ * below the sub bucket count have their own bucket. Larger values
+ * share a bucket with values that have the same leading bits.
+ * 
+ * @param value the value
+ * 
+ * @return the bucket index
+ */
+static size_t timer_histogram_bucket ( uint64_t value )
+{
+
+    // Initialized data
+    size_t shift = 0;
+
+    // Small values are recorded exactly
+    if ( value < SYNC_HISTOGRAM_SUB_BUCKETS ) return (size_t) value;
+
+    // Compute the shift that leaves the leading bits
+    shift = (size_t) ( 63 - __builtin_clzll(value) ) - SYNC_HISTOGRAM_SUB_BUCKET_BITS;
+
+    // Done
+    return ( shift * SYNC_HISTOGRAM_SUB_BUCKETS ) + (size_t) ( value >> shift );
+}
+
+/** !
+ * Compute the highest value that is recorded in a bucket
+ * 
+ * @param bucket the bucket index
+ * 
+ * @return the highest value in the bucket
+ */
+static uint64_t timer_histogram_bucket_value ( size_t bucket )
+{
+
+    // Initialized data
+    size_t shift = 0;
+
+    // Small values are recorded exactly
+    if ( bucket < 2 * SYNC_HISTOGRAM_SUB_BUCKETS ) return (uint64_t) bucket;
+
+    // Compute the shift
+    shift = ( bucket / SYNC_HISTOGRAM_SUB_BUCKETS ) - 1;
+
+    // Done
+    return ( ( (uint64_t) ( bucket - ( shift * SYNC_HISTOGRAM_SUB_BUCKETS ) ) + 1 ) << shift ) - 1;
+}
+
+/** !
+ * Sum a bucket across every shard of a histogram
+ * 
+ * @param p_timer_histogram the histogram
+ * @param bucket            the bucket index
+ * 
+ * @return the quantity of values recorded in the bucket
+ */
+static uint64_t timer_histogram_bucket_count ( timer_histogram *p_timer_histogram, size_t bucket )
+{
+
+    // Initialized data
+    uint64_t ret = 0;
+
+    // Sum the bucket across each shard
+    for (size_t i = 0; i < SYNC_HISTOGRAM_SHARDS; i++)
+        ret += __atomic_load_n(&p_timer_histogram->shards[i].counts[bucket], __ATOMIC_RELAXED);
+
+    // Done
+    return ret;
+}
+
+int timer_histogram_create ( timer_histogram **pp_timer_histogram )
 {
 
     // Argument check
-    if ( p_condition_variable == (void *) 0 ) goto no_condition_variable;
-    
-    // Platform dependent implementation
-    #ifdef _WIN64
-    #else
+    if ( pp_timer_histogram == (void *) 0 ) goto no_timer_histogram;
 
-        // Return
-        return ( pthread_cond_destroy(p_condition_variable) == 0 );
-    #endif
+    // Initialized data
+    timer_histogram *p_timer_histogram = (void *) 0;
+
+    // Allocate memory for the histogram
+    if ( posix_memalign((void **)&p_timer_histogram, SYNC_CACHE_LINE, sizeof(timer_histogram)) ) goto no_mem;
+
+    // Zero set
+    memset(p_timer_histogram, 0, sizeof(timer_histogram));
+
+    // Return a pointer to the caller
+    *pp_timer_histogram = p_timer_histogram;
+
+    // Success
+    return 1;
 
     // Error handling
     {
         
         // Argument errors
         {
-            no_condition_variable:
+            no_timer_histogram:
                 #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_condition_variable\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[sync] [timer] Null pointer provided for parameter \"pp_timer_histogram\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -852,36 +8111,30 @@ int condition_variable_destroy ( condition_variable *p_condition_variable )
         }
     }
 }
-#endif
 
-#ifdef BUILD_SYNC_WITH_MONITOR
-int monitor_create ( monitor *p_monitor )
+int timer_histogram_record ( timer_histogram *p_timer_histogram, timestamp _time )
 {
+
     // Argument check
-    if ( p_monitor == (void *) 0 ) goto no_monitor;
-    
-    // Platform dependent implementation
-    #ifdef _WIN64
-        // TODO
-        //
+    if ( p_timer_histogram == (void *) 0 ) goto no_timer_histogram;
 
-    #else
+    // Pick a shard for this thread
+    if ( timer_histogram_shard == SIZE_MAX ) timer_histogram_shard = __atomic_fetch_add(&timer_histogram_shards, 1, __ATOMIC_RELAXED) % SYNC_HISTOGRAM_SHARDS;
 
-        int ret = ( pthread_cond_init(&p_monitor->_cond, NULL) == 0 );
-        ret &= ( pthread_mutex_init(&p_monitor->_mutex, NULL) == 0 );
+    // Record the value
+    __atomic_fetch_add(&p_timer_histogram->shards[timer_histogram_shard].counts[timer_histogram_bucket( _time < 0 ? 0 : (uint64_t) _time )], 1, __ATOMIC_RELAXED);
 
-        // Return
-        return  ret;
-    #endif
+    // Success
+    return 1;
 
     // Error handling
     {
         
         // Argument errors
         {
-            no_monitor:
+            no_timer_histogram:
                 #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_monitor\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[sync] [timer] Null pointer provided for parameter \"p_timer_histogram\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -890,85 +8143,98 @@ int monitor_create ( monitor *p_monitor )
     }
 }
 
-int monitor_wait ( monitor *p_monitor )
+int timer_histogram_merge ( timer_histogram *p_timer_histogram, timer_histogram *p_other )
 {
 
-    // Platform dependent implementation
-    #ifdef _WIN64
-        
-        // TODO
-    #else
+    // Argument check
+    if ( p_timer_histogram == (void *) 0 ) goto no_timer_histogram;
+    if ( p_other           == (void *) 0 ) goto no_other;
+
+    // Iterate over each bucket
+    for (size_t i = 0; i < SYNC_HISTOGRAM_BUCKETS; i++)
+    {
 
         // Initialized data
-        int ret = 0;
+        uint64_t count = timer_histogram_bucket_count(p_other, i);
 
-        // Lock
-        mutex_lock(&p_monitor->_mutex);
+        // Add the count to the histogram
+        if ( count ) __atomic_fetch_add(&p_timer_histogram->shards[0].counts[i], count, __ATOMIC_RELAXED);
+    }
 
-        // Wait
-        if ( pthread_cond_wait(&p_monitor->_cond, &p_monitor->_mutex) == 0 ) ret = 1;
+    // Success
+    return 1;
 
-        // Unlock
-        mutex_unlock(&p_monitor->_mutex);
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_timer_histogram:
+                #ifndef NDEBUG
+                    log_error("[sync] [timer] Null pointer provided for parameter \"p_timer_histogram\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-        // Return
-        return ret;
-    #endif
+                // Error
+                return 0;
+
+            no_other:
+                #ifndef NDEBUG
+                    log_error("[sync] [timer] Null pointer provided for parameter \"p_other\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
 }
 
-int monitor_notify ( monitor *p_monitor )
+timestamp timer_histogram_percentile ( timer_histogram *p_timer_histogram, double percentile )
 {
 
-    // Platform dependent implementation
-    #ifdef _WIN64
-        
-        // TODO
-    #else
+    // Argument check
+    if ( p_timer_histogram == (void *) 0 ) goto no_timer_histogram;
 
-        // Return
-        return pthread_cond_signal(&p_monitor->_cond);
-    #endif
-}
+    // Initialized data
+    uint64_t total = 0, rank = 0, seen = 0;
 
-int monitor_notify_all ( monitor *p_monitor )
-{
+    // Clamp the percentile
+    if ( percentile < 0.0 ) percentile = 0.0;
+    if ( percentile > 100.0 ) percentile = 100.0;
 
-    // Platform dependent implementation
-    #ifdef _WIN64
-        
-        // TODO
-    #else
+    // Count the recorded values
+    for (size_t i = 0; i < SYNC_HISTOGRAM_BUCKETS; i++)
+        total += timer_histogram_bucket_count(p_timer_histogram, i);
 
-        // Return
-        return pthread_cond_broadcast(&p_monitor->_cond);
-    #endif
-}
+    // Empty histogram
+    if ( total == 0 ) return 0;
 
-int monitor_destroy ( monitor *p_monitor )
-{
-    
-    // Argument check
-    if ( p_monitor == (void *) 0 ) goto no_monitor;
+    // Compute the rank of the percentile
+    rank = (uint64_t) ( ( percentile / 100.0 ) * (double) total + 0.5 );
+    if ( rank == 0 ) rank = 1;
+    if ( rank > total ) rank = total;
 
-    // Platform dependent implementation
-    #ifdef _WIN64
-        // TODO
-        //
+    // Find the bucket that contains the rank
+    for (size_t i = 0; i < SYNC_HISTOGRAM_BUCKETS; i++)
+    {
 
-    #else
+        // Accumulate
+        seen += timer_histogram_bucket_count(p_timer_histogram, i);
 
-        // Return
-        return ( pthread_cond_destroy(&p_monitor->_cond) == 0 ) && ( pthread_mutex_destroy(&p_monitor->_mutex) == 0 );
-    #endif
+        // Done
+        if ( seen >= rank ) return (timestamp) timer_histogram_bucket_value(i);
+    }
+
+    // Done
+    return 0;
 
     // Error handling
     {
         
         // Argument errors
         {
-            no_monitor:
+            no_timer_histogram:
                 #ifndef NDEBUG
-                    log_error("[sync] Null pointer provided for \"p_monitor\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[sync] [timer] Null pointer provided for parameter \"p_timer_histogram\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -976,18 +8242,18 @@ int monitor_destroy ( monitor *p_monitor )
         }
     }
 }
-#endif
 
-#ifdef BUILD_SYNC_WITH_BARRIER
-int barrier_create ( barrier *p_barrier, unsigned int count )
+int timer_histogram_destroy ( timer_histogram **pp_timer_histogram )
 {
 
     // Argument check
-    if ( p_barrier == (void *) 0 ) goto no_barrier;
-    if ( count     ==          0 ) goto no_count;
+    if ( pp_timer_histogram == (void *) 0 ) goto no_timer_histogram;
 
-    // Construct
-    pthread_barrier_init(p_barrier, NULL, count);
+    // Free the histogram
+    free(*pp_timer_histogram);
+
+    // No more pointer for caller
+    *pp_timer_histogram = (void *) 0;
 
     // Success
     return 1;
@@ -997,61 +8263,182 @@ int barrier_create ( barrier *p_barrier, unsigned int count )
         
         // Argument errors
         {
-            no_barrier:
+            no_timer_histogram:
                 #ifndef NDEBUG
-                    log_error("[sync] [barrier] Null pointer provided for parameter \"p_barrier\" in call to function \"%s\"\n");
+                    log_error("[sync] [timer] Null pointer provided for parameter \"pp_timer_histogram\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
-            
-            no_count:
-                #ifndef NDEBUG
-                    log_error("[sync] [barrier] Parameter \"count\" must be greater than zero in call to function \"%s\"\n");
-                #endif
-
-                // Error
-                return 0;                
         }
     }
 }
+#endif
 
-int barrier_wait ( barrier *p_barrier )
+#ifdef BUILD_SYNC_WITH_TRACE
+
+/** !
+ * Release a thread's trace ring. The ring keeps its records for 
+ * sync_trace_dump, until another thread claims it. This gets 
+ * called when a thread exits.
+ * 
+ * @param p_trace_ring the trace ring
+ * 
+ * @return void
+ */
+static void sync_trace_thread_exit ( void *p_trace_ring )
 {
 
-    // Argument check
-    if ( p_barrier == (void *) 0 ) goto no_barrier;
+    // Initialized data
+    struct sync_trace_ring_s *p_ring = p_trace_ring;
 
-    // Wait
-    pthread_barrier_wait(p_barrier);
+    // Clear the ring
+    #ifdef _WIN64
+        FlsSetValue(sync_trace_key, (void *) 0);
+    #else
+        (void) pthread_setspecific(sync_trace_key, (void *) 0);
+    #endif
+    p_sync_trace_ring = (void *) 0;
 
-    // Success
-    return 1;
+    // Release the ring
+    __atomic_store_n(&p_ring->owned, false, __ATOMIC_RELEASE);
 
-    // Error handling
+    // Done
+    return;
+}
+
+void sync_trace_record ( sync_trace_event event, const void *p_object )
+{
+
+    // Initialized data
+    struct sync_trace_ring_s *p_ring = p_sync_trace_ring;
+    uint64_t head = 0;
+
+    // Argument check
+    if ( (unsigned) event >= SYNC_TRACE_EVENT_QUANTITY ) return;
+
+    // Find a ring for this thread
+    if ( p_ring == (void *) 0 )
     {
-        
-        // Argument errors
+
+        // Claim a ring released by an exited thread
+        for (p_ring = __atomic_load_n(&p_sync_trace_rings, __ATOMIC_ACQUIRE); p_ring; p_ring = p_ring->p_next)
         {
-            no_barrier:
-                #ifndef NDEBUG
-                    log_error("[sync] [barrier] Null pointer provided for parameter \"p_barrier\" in call to function \"%s\"\n");
-                #endif
 
-                // Error
-                return 0;
+            // Initialized data
+            bool owned = false;
+
+            // Claim the ring
+            if ( __atomic_compare_exchange_n(&p_ring->owned, &owned, true, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) ) break;
+        }
+
+        // Construct a ring for this thread
+        if ( p_ring == (void *) 0 )
+        {
+
+            // Allocate memory for the ring
+            p_ring = calloc(1, sizeof(struct sync_trace_ring_s));
+
+            // Error check
+            if ( p_ring == (void *) 0 ) return;
+
+            // Own the ring
+            p_ring->owned = true;
+
+            // Add the ring to the list of rings
+            p_ring->p_next = __atomic_load_n(&p_sync_trace_rings, __ATOMIC_RELAXED);
+            while ( !__atomic_compare_exchange_n(&p_sync_trace_rings, &p_ring->p_next, p_ring, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED) );
         }
+
+        // Start the ring over
+        __atomic_store_n(&p_ring->head, 0, __ATOMIC_RELEASE);
+
+        // Store the thread id
+        #ifdef _WIN64
+            p_ring->thread = (long) GetCurrentThreadId();
+        #else
+            p_ring->thread = syscall(SYS_gettid);
+        #endif
+
+        // Store the ring
+        #ifdef _WIN64
+            FlsSetValue(sync_trace_key, p_ring);
+        #else
+            (void) pthread_setspecific(sync_trace_key, p_ring);
+        #endif
+        p_sync_trace_ring = p_ring;
     }
+
+    // Store the record
+    head = p_ring->head;
+    p_ring->records[head % SYNC_TRACE_RING_SIZE]._time    = timer_high_precision();
+    p_ring->records[head % SYNC_TRACE_RING_SIZE].p_object = p_object;
+    p_ring->records[head % SYNC_TRACE_RING_SIZE].event    = event;
+
+    // Publish the record
+    __atomic_store_n(&p_ring->head, head + 1, __ATOMIC_RELEASE);
+
+    // Done
+    return;
 }
 
-int barrier_destroy ( barrier *p_barrier )
+int sync_trace_dump ( FILE *p_f )
 {
 
     // Argument check
-    if ( p_barrier == (void *) 0 ) goto no_barrier;
+    if ( p_f == (void *) 0 ) goto no_file;
+
+    // Initialized data
+    const double us = 1000000.0 / (double) timer_seconds_divisor();
+    #ifdef _WIN64
+        const int pid = (int) GetCurrentProcessId();
+    #else
+        const int pid = (int) getpid();
+    #endif
+    bool first = true;
+
+    // Start the trace
+    fprintf(p_f, "{\"traceEvents\":[");
+
+    // Iterate over each ring
+    for (struct sync_trace_ring_s *p_ring = __atomic_load_n(&p_sync_trace_rings, __ATOMIC_ACQUIRE); p_ring; p_ring = p_ring->p_next)
+    {
 
-    // Destroy
-    pthread_barrier_destroy(p_barrier);
+        // Initialized data
+        uint64_t head = __atomic_load_n(&p_ring->head, __ATOMIC_ACQUIRE),
+                 tail = ( head > SYNC_TRACE_RING_SIZE ) ? head - SYNC_TRACE_RING_SIZE : 0;
+
+        // Iterate over each record that has not been overwritten
+        for (uint64_t i = tail; i < head; i++)
+        {
+
+            // Initialized data
+            const double ts = (double) p_ring->records[i % SYNC_TRACE_RING_SIZE]._time * us;
+            const void *p_object = p_ring->records[i % SYNC_TRACE_RING_SIZE].p_object;
+            const char *p_end = (void *) 0, *p_begin = (void *) 0;
+
+            // Each record ends one span, and begins another. Spans are keyed by 
+            // object and thread, so waiters on the same object don't pair up
+            switch ( p_ring->records[i % SYNC_TRACE_RING_SIZE].event )
+            {
+                case SYNC_TRACE_MUTEX_LOCK:     p_begin = "mutex wait";                            break;
+                case SYNC_TRACE_MUTEX_ACQUIRED: p_end   = "mutex wait", p_begin = "mutex held"; break;
+                case SYNC_TRACE_MUTEX_UNLOCK:   p_end   = "mutex held";                            break;
+                default: continue;
+            }
+
+            // Write the end of a span
+            if ( p_end )
+                fprintf(p_f, "%s\n{\"name\":\"%s\",\"cat\":\"sync\",\"ph\":\"e\",\"id\":\"%p.%ld\",\"ts\":%.3f,\"pid\":%d,\"tid\":%ld,\"args\":{\"object\":\"%p\"}}", first ? "" : ",", p_end, p_object, p_ring->thread, ts, pid, p_ring->thread, p_object), first = false;
+
+            // Write the start of a span
+            if ( p_begin )
+                fprintf(p_f, "%s\n{\"name\":\"%s\",\"cat\":\"sync\",\"ph\":\"b\",\"id\":\"%p.%ld\",\"ts\":%.3f,\"pid\":%d,\"tid\":%ld,\"args\":{\"object\":\"%p\"}}", first ? "" : ",", p_begin, p_object, p_ring->thread, ts, pid, p_ring->thread, p_object), first = false;
+        }
+    }
+
+    // End the trace
+    fprintf(p_f, "\n]}\n");
 
     // Success
     return 1;
@@ -1061,9 +8448,9 @@ int barrier_destroy ( barrier *p_barrier )
         
         // Argument errors
         {
-            no_barrier:
+            no_file:
                 #ifndef NDEBUG
-                    log_error("[sync] [barrier] Null pointer provided for parameter \"p_barrier\" in call to function \"%s\"\n");
+                    log_error("[sync] [trace] Null pointer provided for parameter \"p_f\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -1073,51 +8460,119 @@ int barrier_destroy ( barrier *p_barrier )
 }
 #endif
 
-#ifdef BUILD_SYNC_WITH_TIMER
-timestamp timer_high_precision ( void )
+void sync_exit ( void ) 
 {
-    
-    // Initialized data
-    timestamp ret = 0;
 
-    // Platform dependent implementation
-    #ifdef _WIN64
+    // State check
+    if ( initialized == false ) return;
 
-        // Query the performance counter
-        QueryPerformanceCounter((LARGE_INTEGER *)&ret);
-    #else
+    // Run the calling thread's deferred callbacks
+    #ifdef BUILD_SYNC_WITH_RCU
+        if ( p_rcu_thread ) rcu_thread_exit(p_rcu_thread);
+    #endif
+
+    // Reclaim the calling thread's retired pointers
+    #ifdef BUILD_SYNC_WITH_HAZARD_POINTER
+    {
 
         // Initialized data
-        struct timespec ts;
+        struct hazptr_thread_s *p_thread = (void *) 0;
+        bool live = false;
 
-        // Populate the time struct using the monotonic timer
-        clock_gettime(CLOCK_MONOTONIC, &ts);
+        // Release the calling thread's record
+        if ( p_hazptr_thread ) hazptr_thread_exit(p_hazptr_thread);
 
-        // Compute the monotonic time in nanoseconds
-        ret = ( (signed)ts.tv_sec * SEC_2_NS ) + ( (signed) ts.tv_nsec );
-    #endif
+        // Take the list of records
+        p_thread = __atomic_exchange_n(&p_hazptr_threads, (void *) 0, __ATOMIC_ACQ_REL);
 
-    // Error
-    return ret;
-}
+        // Free each released record. Live threads keep theirs
+        while ( p_thread )
+        {
 
-signed timer_seconds_divisor ( void )
-{
+            // Initialized data
+            struct hazptr_thread_s *p_next = p_thread->p_next;
+            uint32_t expected = 0;
+
+            // Free the record, unless another thread could claim it
+            if ( __atomic_compare_exchange_n(&p_thread->active, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) )
+            {
+                free(p_thread);
+                __atomic_fetch_sub(&hazptr_threads, 1, __ATOMIC_RELAXED);
+            }
+
+            // Return the record to the list
+            else
+            {
+                live = true;
+                p_thread->p_next = __atomic_load_n(&p_hazptr_threads, __ATOMIC_RELAXED);
+                while ( !__atomic_compare_exchange_n(&p_hazptr_threads, &p_thread->p_next, p_thread, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED) );
+            }
+
+            // Iterate
+            p_thread = p_next;
+        }
 
-    // Done
-    return SYNC_TIMER_DIVISOR;
-}
-#endif
+        // Reclaim the orphans, once no thread can protect them
+        if ( live == false )
+        {
 
-void sync_exit ( void ) 
-{
+            // Lock
+            sync_word_lock(&hazptr_lock);
 
-    // State check
-    if ( initialized == false ) return;
+            // Reclaim each orphan
+            for (size_t i = 0; i < hazptr_orphans; i++) p_hazptr_orphans[i].pfn_hazptr_reclaim(p_hazptr_orphans[i].p_value);
+
+            // Free the orphans
+            free(p_hazptr_orphans);
+            p_hazptr_orphans = (void *) 0;
+            __atomic_store_n(&hazptr_orphans, 0, __ATOMIC_RELAXED);
+
+            // Unlock
+            sync_word_unlock(&hazptr_lock);
+        }
+    }
+    #endif
 
     // Clean up log
     log_exit();
 
+    // Clean up the trace rings
+    #ifdef BUILD_SYNC_WITH_TRACE
+    {
+
+        // Initialized data
+        struct sync_trace_ring_s *p_ring = (void *) 0;
+
+        // Release the calling thread's ring
+        if ( p_sync_trace_ring ) sync_trace_thread_exit(p_sync_trace_ring);
+
+        // Take the list of rings
+        p_ring = __atomic_exchange_n(&p_sync_trace_rings, (void *) 0, __ATOMIC_ACQ_REL);
+
+        // Free each released ring. Live threads keep theirs
+        while ( p_ring )
+        {
+
+            // Initialized data
+            struct sync_trace_ring_s *p_next = p_ring->p_next;
+            bool owned = false;
+
+            // Free the ring, unless another thread could claim it
+            if ( __atomic_compare_exchange_n(&p_ring->owned, &owned, true, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) ) free(p_ring);
+
+            // Return the ring to the list
+            else
+            {
+                p_ring->p_next = __atomic_load_n(&p_sync_trace_rings, __ATOMIC_RELAXED);
+                while ( !__atomic_compare_exchange_n(&p_sync_trace_rings, &p_ring->p_next, p_ring, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED) );
+            }
+
+            // Iterate
+            p_ring = p_next;
+        }
+    }
+    #endif
+
     // TODO: Anything else?
     // 
 